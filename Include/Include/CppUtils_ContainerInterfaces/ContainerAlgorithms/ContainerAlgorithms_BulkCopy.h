@@ -0,0 +1,115 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Traits.h>
+
+/*
+* Bulk element transfer between any pair of containers.
+*
+* The destination isn't resized. Transfers cover the overlapping prefix of both containers, and return the number
+* of elements written. When both containers are contiguous with the same trivially copyable element type, the
+* transfer is a single `memmove`, so the storage of the two containers may overlap (e.g. views into the same buffer).
+* Otherwise it falls back to element-wise assignment through `GetElement`.
+*/
+namespace CppUtils::ContainerAlgorithms
+{
+    template <class DstContainerType, class SrcContainerType>
+    constexpr std::size_t CopyInto(DstContainerType& dst, const SrcContainerType& src)
+    {
+        const std::size_t count = std::min<std::size_t>(ContainerOps::GetSize{dst}.Do(), ContainerOps::GetSize{src}.Do());
+
+        if constexpr (Detail::IsBitwiseTransferable<DstContainerType, SrcContainerType>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                auto* const dstData = ContainerOps::GetData{dst}.Do();
+                const auto* const srcData = ContainerOps::GetData{src}.Do();
+                if (count > 0 && static_cast<const void*>(dstData) != static_cast<const void*>(srcData))
+                {
+                    std::memmove(dstData, srcData, count * sizeof(Detail::ContainerValueType_t<DstContainerType>));
+                }
+                return count;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ContainerOps::GetElement{dst}.Do(i) = ContainerOps::GetElement{src}.Do(i);
+        }
+
+        return count;
+    }
+
+    /*
+    * Like `CopyInto`, but moves from the source elements.
+    */
+    template <class DstContainerType, class SrcContainerType>
+    constexpr std::size_t MoveInto(DstContainerType& dst, SrcContainerType& src)
+    {
+        const std::size_t count = std::min<std::size_t>(ContainerOps::GetSize{dst}.Do(), ContainerOps::GetSize{src}.Do());
+
+        if constexpr (Detail::IsBitwiseTransferable<DstContainerType, SrcContainerType>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                if (count > 0)
+                {
+                    std::memmove(ContainerOps::GetData{dst}.Do(), ContainerOps::GetData{src}.Do(), count * sizeof(Detail::ContainerValueType_t<DstContainerType>));
+                }
+                return count;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ContainerOps::GetElement{dst}.Do(i) = std::move(ContainerOps::GetElement{src}.Do(i));
+        }
+
+        return count;
+    }
+
+    /*
+    * Assigns the value to every element of the container. Contiguous storage is filled with `memset` for byte-sized
+    * elements, and with a tight `std::fill_n` loop (which compilers vectorize) otherwise.
+    */
+    template <class ContainerType, class ValueType>
+    constexpr void Fill(ContainerType& container, const ValueType& value)
+    {
+        using ElementValueType = Detail::ContainerValueType_t<ContainerType>;
+
+        const std::size_t size = ContainerOps::GetSize{container}.Do();
+
+        if constexpr (Detail::IsContiguousContainer<ContainerType>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                ElementValueType* const data = ContainerOps::GetData{container}.Do();
+
+                if constexpr (sizeof(ElementValueType) == 1 && std::is_trivially_copyable_v<ElementValueType>)
+                {
+                    const ElementValueType byteValue = static_cast<ElementValueType>(value);
+                    unsigned char byte;
+                    std::memcpy(&byte, &byteValue, 1);
+                    std::memset(data, byte, size);
+                }
+                else
+                {
+                    std::fill_n(data, size, value);
+                }
+                return;
+            }
+        }
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            ContainerOps::GetElement{container}.Do(i) = value;
+        }
+    }
+}
@@ -0,0 +1,188 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+
+namespace CppUtils::ContainerAlgorithms
+{
+    struct CompactionSettings
+    {
+        // Containers are shrunk once their capacity exceeds their size by this factor.
+        double MaxCapacityToSizeRatio = 2.0;
+
+        // Containers with less slack than this aren't worth the copy.
+        std::size_t MinSlackBytes = 4 * 1024;
+
+        // Upper bound on the bytes copied by a single `Run`.
+        std::size_t CopyBudgetBytes = 1024 * 1024;
+    };
+
+    struct CompactionRunResult
+    {
+        std::size_t ContainersShrunk = 0;
+        std::size_t BytesCopied = 0;
+        std::size_t BytesReclaimed = 0;
+
+        // Whether every registered container was visited. If not, the next run resumes where this one stopped.
+        bool bCompletedPass = false;
+    };
+
+    /*
+    * Shrinks registered containers whose capacity has grown well beyond their size, e.g. after a traffic burst.
+    *
+    * Each `Run` is one incremental step of a round-robin walk over the registered containers, and is bounded by a
+    * budget on how many bytes may be copied by shrinking. The next `Run` resumes where the previous one stopped. This
+    * lets callers invoke it on a memory-pressure signal (or periodically) without a latency spike. Containers that
+    * couldn't be shrunk within the budget on their own are skipped.
+    *
+    * Registered containers must implement `GetSize`, `GetCapacity`, `GetMemoryUsage` and `ShrinkToFit`.
+    *
+    * Not thread-safe. Register, unregister and run from the thread that owns the registered containers.
+    */
+    class CompactionPolicy
+    {
+    public:
+
+        using RegistrationId = std::uint64_t;
+
+        explicit CompactionPolicy(const CompactionSettings& settings = CompactionSettings{})
+            : m_Settings(settings)
+        {
+        }
+
+        /*
+        * Registers the container for compaction. It must stay alive until unregistered.
+        */
+        template <class ContainerType>
+        RegistrationId Register(ContainerType& container)
+        {
+            Registration registration;
+            registration.Id = ++m_LastRegistrationId;
+            registration.Container = std::addressof(container);
+            registration.GetSize = [](const void* erasedContainer) -> std::size_t
+                {
+                    return ContainerOps::GetSize{*static_cast<const ContainerType*>(erasedContainer)}.Do();
+                };
+            registration.GetCapacity = [](const void* erasedContainer) -> std::size_t
+                {
+                    return ContainerOps::GetCapacity{*static_cast<const ContainerType*>(erasedContainer)}.Do();
+                };
+            registration.GetMemoryUsage = [](const void* erasedContainer)
+                {
+                    return ContainerOps::GetMemoryUsage{*static_cast<const ContainerType*>(erasedContainer)}.Do();
+                };
+            registration.ShrinkToFit = [](void* erasedContainer)
+                {
+                    ContainerOps::ShrinkToFit{*static_cast<ContainerType*>(erasedContainer)}.Do();
+                };
+
+            m_Registrations.push_back(registration);
+            return registration.Id;
+        }
+
+        void Unregister(const RegistrationId id)
+        {
+            const auto it = std::find_if(m_Registrations.begin(), m_Registrations.end(), [id](const Registration& registration) { return registration.Id == id; });
+            if (it == m_Registrations.end())
+            {
+                return;
+            }
+
+            // Keep the cursor on the same next container.
+            if (static_cast<std::size_t>(it - m_Registrations.begin()) < m_Cursor)
+            {
+                --m_Cursor;
+            }
+
+            m_Registrations.erase(it);
+        }
+
+        std::size_t GetRegistrationCount() const
+        {
+            return m_Registrations.size();
+        }
+
+        CompactionRunResult Run()
+        {
+            return Run(m_Settings.CopyBudgetBytes);
+        }
+
+        /*
+        * Runs a step with a custom budget, e.g. a larger one under severe memory pressure.
+        */
+        CompactionRunResult Run(const std::size_t copyBudgetBytes)
+        {
+            CompactionRunResult result;
+
+            std::size_t visitedCount = 0;
+            while (visitedCount < m_Registrations.size())
+            {
+                if (m_Cursor >= m_Registrations.size())
+                {
+                    m_Cursor = 0;
+                }
+
+                const Registration& registration = m_Registrations[m_Cursor];
+
+                if (ShouldCompact(registration))
+                {
+                    const ContainerOps::ContainerMemoryUsage usageBefore = registration.GetMemoryUsage(registration.Container);
+                    const std::size_t bytesToCopy = usageBefore.HeapBytes - usageBefore.SlackBytes;
+
+                    if (bytesToCopy <= copyBudgetBytes && usageBefore.SlackBytes >= m_Settings.MinSlackBytes)
+                    {
+                        if (result.BytesCopied + bytesToCopy > copyBudgetBytes)
+                        {
+                            // Out of budget. Resume from this container next run.
+                            return result;
+                        }
+
+                        registration.ShrinkToFit(registration.Container);
+
+                        const ContainerOps::ContainerMemoryUsage usageAfter = registration.GetMemoryUsage(registration.Container);
+                        result.BytesCopied += bytesToCopy;
+                        result.BytesReclaimed += usageBefore.HeapBytes - std::min(usageBefore.HeapBytes, usageAfter.HeapBytes);
+                        ++result.ContainersShrunk;
+                    }
+                }
+
+                ++m_Cursor;
+                ++visitedCount;
+            }
+
+            result.bCompletedPass = true;
+            return result;
+        }
+
+    private:
+
+        struct Registration
+        {
+            RegistrationId Id = 0;
+            void* Container = nullptr;
+            std::size_t (*GetSize)(const void*) = nullptr;
+            std::size_t (*GetCapacity)(const void*) = nullptr;
+            ContainerOps::ContainerMemoryUsage (*GetMemoryUsage)(const void*) = nullptr;
+            void (*ShrinkToFit)(void*) = nullptr;
+        };
+
+        bool ShouldCompact(const Registration& registration) const
+        {
+            const std::size_t capacity = registration.GetCapacity(registration.Container);
+            const std::size_t size = registration.GetSize(registration.Container);
+            return capacity > 0
+                && static_cast<double>(capacity) > static_cast<double>(size) * m_Settings.MaxCapacityToSizeRatio;
+        }
+
+        CompactionSettings m_Settings;
+        std::vector<Registration> m_Registrations;
+        std::size_t m_Cursor = 0;
+        RegistrationId m_LastRegistrationId = 0;
+    };
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Traits.h>
+
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+    /*
+    * Whether equality of the elements is equivalent to equality of their bytes.
+    */
+    template <class LhsContainerType, class RhsContainerType>
+    concept IsBitwiseEqualityComparable =
+        IsContiguousContainer<LhsContainerType>
+        && IsContiguousContainer<RhsContainerType>
+        && std::is_same_v<ContainerValueType_t<LhsContainerType>, ContainerValueType_t<RhsContainerType>>
+        && std::has_unique_object_representations_v<ContainerValueType_t<LhsContainerType>>;
+
+    /*
+    * Whether the elements order the same way as `memcmp` orders their bytes (i.e. as unsigned bytes).
+    */
+    template <class T>
+    concept IsMemcmpOrdered =
+        std::is_same_v<T, unsigned char>
+        || std::is_same_v<T, std::byte>
+        || std::is_same_v<T, char8_t>
+        || (std::is_same_v<T, char> && std::is_unsigned_v<char>);
+
+    template <class LhsContainerType, class RhsContainerType>
+    concept IsBitwiseOrderComparable =
+        IsContiguousContainer<LhsContainerType>
+        && IsContiguousContainer<RhsContainerType>
+        && std::is_same_v<ContainerValueType_t<LhsContainerType>, ContainerValueType_t<RhsContainerType>>
+        && IsMemcmpOrdered<ContainerValueType_t<LhsContainerType>>;
+}
+
+/*
+* Element-wise comparisons between any pair of containers. Contiguous storage of bitwise comparable elements
+* is compared with `memcmp`, otherwise elements are compared one by one through `GetElement`.
+*/
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Whether both containers have the same size and equal elements.
+    */
+    template <class LhsContainerType, class RhsContainerType>
+    constexpr bool Equal(const LhsContainerType& lhs, const RhsContainerType& rhs)
+    {
+        const std::size_t size = ContainerOps::GetSize{lhs}.Do();
+        if (size != ContainerOps::GetSize{rhs}.Do())
+        {
+            return false;
+        }
+
+        if constexpr (Detail::IsBitwiseEqualityComparable<LhsContainerType, RhsContainerType>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return size == 0
+                    || std::memcmp(ContainerOps::GetData{lhs}.Do(), ContainerOps::GetData{rhs}.Do(), size * sizeof(Detail::ContainerValueType_t<LhsContainerType>)) == 0;
+            }
+        }
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (!(ContainerOps::GetElement{lhs}.Do(i) == ContainerOps::GetElement{rhs}.Do(i)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*
+    * Lexicographically compares the containers' elements, with the shorter container ordering first on a common prefix.
+    */
+    template <class LhsContainerType, class RhsContainerType>
+    constexpr auto Compare(const LhsContainerType& lhs, const RhsContainerType& rhs)
+        -> std::compare_three_way_result_t<Detail::ContainerValueType_t<LhsContainerType>, Detail::ContainerValueType_t<RhsContainerType>>
+    {
+        using OrderingType = std::compare_three_way_result_t<Detail::ContainerValueType_t<LhsContainerType>, Detail::ContainerValueType_t<RhsContainerType>>;
+
+        const std::size_t lhsSize = ContainerOps::GetSize{lhs}.Do();
+        const std::size_t rhsSize = ContainerOps::GetSize{rhs}.Do();
+        const std::size_t commonSize = std::min(lhsSize, rhsSize);
+
+        if constexpr (Detail::IsBitwiseOrderComparable<LhsContainerType, RhsContainerType>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const int result = commonSize == 0 ? 0 : std::memcmp(ContainerOps::GetData{lhs}.Do(), ContainerOps::GetData{rhs}.Do(), commonSize);
+                if (result != 0)
+                {
+                    return result < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+                }
+                return lhsSize <=> rhsSize;
+            }
+        }
+
+        for (std::size_t i = 0; i < commonSize; ++i)
+        {
+            const OrderingType elementOrdering = ContainerOps::GetElement{lhs}.Do(i) <=> ContainerOps::GetElement{rhs}.Do(i);
+            if (elementOrdering != 0)
+            {
+                return elementOrdering;
+            }
+        }
+
+        return lhsSize <=> rhsSize;
+    }
+
+    /*
+    * Equality functor over containers, e.g. for keying hash maps by container contents alongside `ContainerHasher`.
+    */
+    struct ContainerEqualTo
+    {
+        template <class LhsContainerType, class RhsContainerType>
+        constexpr bool operator()(const LhsContainerType& lhs, const RhsContainerType& rhs) const
+        {
+            return Equal(lhs, rhs);
+        }
+    };
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+/*
+* Detection of the SIMD instruction sets that algorithm kernels can use.
+*
+* SSE2 is part of x86-64, so x86-64 kernels can always use it. AVX2 kernels are compiled alongside them (see
+* `CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2`) and must only be called when `IsAvx2Supported()`.
+*/
+#if defined(__x86_64__) || defined(_M_X64)
+#   define CPPUTILS_CONTAINERALGORITHMS_X86_SIMD 1
+#   include <immintrin.h>
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   endif
+#else
+#   define CPPUTILS_CONTAINERALGORITHMS_X86_SIMD 0
+#endif
+
+// Lets individual functions use AVX2 instructions without compiling the whole program for AVX2. MSVC allows intrinsics anywhere.
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD && (defined(__GNUC__) || defined(__clang__))
+#   define CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#   define CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2
+#endif
+
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+    /*
+    * Whether the CPU (and OS) support AVX2. Checked once, at first use.
+    */
+    inline bool IsAvx2Supported()
+    {
+#if defined(__AVX2__)
+        return true;
+#elif defined(_MSC_VER)
+        static const bool bIsSupported = []()
+            {
+                int cpuInfo[4];
+                __cpuid(cpuInfo, 0);
+                if (cpuInfo[0] < 7)
+                {
+                    return false;
+                }
+
+                // The OS must save the YMM registers on context switches.
+                __cpuid(cpuInfo, 1);
+                const bool bHasOsxsaveAndAvx = (cpuInfo[2] & (1 << 27)) && (cpuInfo[2] & (1 << 28));
+                if (!bHasOsxsaveAndAvx || (_xgetbv(0) & 0x6) != 0x6)
+                {
+                    return false;
+                }
+
+                __cpuidex(cpuInfo, 7, 0);
+                return (cpuInfo[1] & (1 << 5)) != 0;
+            }();
+        return bIsSupported;
+#else
+        static const bool bIsSupported = __builtin_cpu_supports("avx2");
+        return bIsSupported;
+#endif
+    }
+#endif
+}
@@ -0,0 +1,204 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Traits.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_CpuFeatures.h>
+
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+    /*
+    * Elements are compacted in blocks of this many, one bit of keep mask per element.
+    */
+    inline constexpr std::size_t CompactionBlockSize = 64;
+
+    /*
+    * Evaluates the predicate over a block, without branching on its results. Bit i is set if element i is kept.
+    */
+    template <class T, class PredicateType>
+    std::uint64_t GetKeepMask(const T* const block, const std::size_t count, PredicateType& predicate)
+    {
+        std::uint64_t keepMask = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            keepMask |= static_cast<std::uint64_t>(!static_cast<bool>(predicate(std::as_const(block[i])))) << i;
+        }
+        return keepMask;
+    }
+
+    /*
+    * Branchless compaction. Every element is stored to the write position, which only advances for kept elements.
+    */
+    template <class T>
+    T* CompactBlockScalar(T* write, const T* const block, const std::size_t count, const std::uint64_t keepMask)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            *write = block[i];
+            write += (keepMask >> i) & 1;
+        }
+        return write;
+    }
+
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+    /*
+    * For each 8-bit keep mask, the 32-bit lane indices of the kept lanes, packed to the front (one index per byte).
+    * With `bIsWideLane`, each mask bit covers two 32-bit lanes (i.e. one 64-bit element), and only 4 bits are used.
+    */
+    template <bool bIsWideLane>
+    consteval std::array<std::uint64_t, (bIsWideLane ? 16 : 256)> MakeCompactionShuffleTable()
+    {
+        std::array<std::uint64_t, (bIsWideLane ? 16 : 256)> table {};
+        for (std::size_t mask = 0; mask < table.size(); ++mask)
+        {
+            std::uint64_t indices = 0;
+            std::size_t packedLaneCount = 0;
+            for (std::size_t bit = 0; bit < (bIsWideLane ? 4 : 8); ++bit)
+            {
+                if (mask & (std::size_t{1} << bit))
+                {
+                    if constexpr (bIsWideLane)
+                    {
+                        indices |= static_cast<std::uint64_t>(bit * 2) << (8 * packedLaneCount++);
+                        indices |= static_cast<std::uint64_t>(bit * 2 + 1) << (8 * packedLaneCount++);
+                    }
+                    else
+                    {
+                        indices |= static_cast<std::uint64_t>(bit) << (8 * packedLaneCount++);
+                    }
+                }
+            }
+            table[mask] = indices;
+        }
+        return table;
+    }
+
+    inline constexpr std::array<std::uint64_t, 256> CompactionShuffleTable32 = MakeCompactionShuffleTable<false>();
+    inline constexpr std::array<std::uint64_t, 16> CompactionShuffleTable64 = MakeCompactionShuffleTable<true>();
+
+    /*
+    * Compacts a full block of 4 or 8 byte elements, one 256-bit vector at a time. Each vector's kept lanes are
+    * permuted to the front and the whole vector is stored at the write position. The lanes stored past the kept
+    * ones land on elements that were already loaded, so they are either overwritten later or truncated away.
+    */
+    template <class T>
+    CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2 T* CompactBlockAvx2(T* write, const T* const block, const std::uint64_t keepMask)
+    {
+        constexpr std::size_t laneCount = sizeof(__m256i) / sizeof(T);
+        constexpr std::uint64_t laneMask = (std::uint64_t{1} << laneCount) - 1;
+
+        for (std::size_t i = 0; i < CompactionBlockSize; i += laneCount)
+        {
+            const std::size_t vectorKeepMask = static_cast<std::size_t>((keepMask >> i) & laneMask);
+            std::uint64_t packedIndices;
+            if constexpr (sizeof(T) == 4)
+            {
+                packedIndices = CompactionShuffleTable32[vectorKeepMask];
+            }
+            else
+            {
+                packedIndices = CompactionShuffleTable64[vectorKeepMask];
+            }
+
+            const __m256i permutation = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(packedIndices)));
+            const __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(write), _mm256_permutevar8x32_epi32(lanes, permutation));
+            write += std::popcount(vectorKeepMask);
+        }
+        return write;
+    }
+#endif
+
+    /*
+    * Removes the elements matching the predicate from contiguous trivially copyable storage, in place and in order.
+    * Returns the number of elements kept.
+    */
+    template <class T, class PredicateType>
+    std::size_t CompactContiguous(T* const data, const std::size_t count, PredicateType& predicate)
+    {
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+        constexpr bool bHasVectorKernel = sizeof(T) == 4 || sizeof(T) == 8;
+        const bool bUseVectorKernel = bHasVectorKernel && IsAvx2Supported();
+#endif
+
+        T* write = data;
+        for (std::size_t blockStart = 0; blockStart < count; blockStart += CompactionBlockSize)
+        {
+            const std::size_t blockCount = count - blockStart < CompactionBlockSize ? count - blockStart : CompactionBlockSize;
+            T* const block = data + blockStart;
+            const std::uint64_t keepMask = GetKeepMask(block, blockCount, predicate);
+
+            // Common case of nothing removed yet. No need to move anything.
+            if (write == block && keepMask == (blockCount == CompactionBlockSize ? ~std::uint64_t{0} : (std::uint64_t{1} << blockCount) - 1))
+            {
+                write += blockCount;
+                continue;
+            }
+
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+            if constexpr (bHasVectorKernel)
+            {
+                if (bUseVectorKernel && blockCount == CompactionBlockSize)
+                {
+                    write = CompactBlockAvx2(write, block, keepMask);
+                    continue;
+                }
+            }
+#endif
+
+            write = CompactBlockScalar(write, block, blockCount, keepMask);
+        }
+
+        return static_cast<std::size_t>(write - data);
+    }
+}
+
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Removes all elements matching the predicate, keeping the rest in order. Returns the number of elements removed.
+    * Requires the `Truncate` op.
+    *
+    * Contiguous (`GetData`) trivially copyable elements are compacted without branching on the predicate's results,
+    * which keeps removal of large random fractions of elements free of branch mispredictions. With AVX2, 4 and 8 byte
+    * elements are compacted a vector at a time. Other containers move their kept elements down through `GetElement`.
+    */
+    template <class ContainerType, class PredicateType>
+    std::size_t EraseIf(ContainerType& container, PredicateType predicate)
+    {
+        using ElementValueType = Detail::ContainerValueType_t<ContainerType>;
+
+        const std::size_t size = ContainerOps::GetSize{container}.Do();
+
+        std::size_t keptCount = 0;
+        if constexpr (Detail::IsContiguousContainer<ContainerType> && std::is_trivially_copyable_v<ElementValueType>)
+        {
+            keptCount = Detail::CompactContiguous(ContainerOps::GetData{container}.Do(), size, predicate);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                auto& element = ContainerOps::GetElement{container}.Do(i);
+                if (!predicate(std::as_const(element)))
+                {
+                    if (keptCount != i)
+                    {
+                        ContainerOps::GetElement{container}.Do(keptCount) = std::move(element);
+                    }
+                    ++keptCount;
+                }
+            }
+        }
+
+        ContainerOps::Truncate{container}.Do(keptCount);
+        return size - keptCount;
+    }
+}
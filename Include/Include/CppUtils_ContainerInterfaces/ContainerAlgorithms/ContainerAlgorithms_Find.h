@@ -0,0 +1,325 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Traits.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_CpuFeatures.h>
+
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+    /*
+    * Whether elements can be compared for equality as raw 8/16/32/64-bit lanes.
+    */
+    template <class T>
+    concept IsSimdScannable = std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    /*
+    * Scans lane by lane. Returns the index of the first match, or `count` if there is none.
+    */
+    template <class T>
+    std::size_t FindValueScalar(const T* const data, const std::size_t count, const T value)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (data[i] == value)
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    template <class T>
+    std::size_t CountValueScalar(const T* const data, const std::size_t count, const T value)
+    {
+        std::size_t matchCount = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            matchCount += data[i] == value;
+        }
+        return matchCount;
+    }
+
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+    /*
+    * SSE2 kernels. SSE2 is part of x86-64, so these need no dispatch.
+    */
+    template <class T>
+    __m128i BroadcastSse2(const T value)
+    {
+        if constexpr (sizeof(T) == 1) { return _mm_set1_epi8(static_cast<char>(value)); }
+        else if constexpr (sizeof(T) == 2) { return _mm_set1_epi16(static_cast<short>(value)); }
+        else if constexpr (sizeof(T) == 4) { return _mm_set1_epi32(static_cast<int>(value)); }
+        else { return _mm_set1_epi64x(static_cast<long long>(value)); }
+    }
+
+    template <class T>
+    __m128i CompareEqualSse2(const __m128i lhs, const __m128i rhs)
+    {
+        if constexpr (sizeof(T) == 1) { return _mm_cmpeq_epi8(lhs, rhs); }
+        else if constexpr (sizeof(T) == 2) { return _mm_cmpeq_epi16(lhs, rhs); }
+        else if constexpr (sizeof(T) == 4) { return _mm_cmpeq_epi32(lhs, rhs); }
+        else
+        {
+            // No 64-bit compare before SSE4.1. A 64-bit lane matches if both of its 32-bit halves do.
+            const __m128i halvesEqual = _mm_cmpeq_epi32(lhs, rhs);
+            return _mm_and_si128(halvesEqual, _mm_shuffle_epi32(halvesEqual, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+
+    template <class T>
+    std::size_t FindValueSse2(const T* const data, const std::size_t count, const T value)
+    {
+        constexpr std::size_t laneCount = sizeof(__m128i) / sizeof(T);
+
+        const __m128i needle = BroadcastSse2(value);
+        std::size_t i = 0;
+        for (; i + laneCount <= count; i += laneCount)
+        {
+            const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const unsigned int matchMask = static_cast<unsigned int>(_mm_movemask_epi8(CompareEqualSse2<T>(lanes, needle)));
+            if (matchMask != 0)
+            {
+                return i + static_cast<std::size_t>(std::countr_zero(matchMask)) / sizeof(T);
+            }
+        }
+        return i + FindValueScalar(data + i, count - i, value);
+    }
+
+    template <class T>
+    std::size_t CountValueSse2(const T* const data, const std::size_t count, const T value)
+    {
+        constexpr std::size_t laneCount = sizeof(__m128i) / sizeof(T);
+
+        const __m128i needle = BroadcastSse2(value);
+        std::size_t matchByteCount = 0;
+        std::size_t i = 0;
+        for (; i + laneCount <= count; i += laneCount)
+        {
+            const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            matchByteCount += static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_epi8(CompareEqualSse2<T>(lanes, needle)))));
+        }
+        return matchByteCount / sizeof(T) + CountValueScalar(data + i, count - i, value);
+    }
+
+    /*
+    * AVX2 kernels. Only call these when `IsAvx2Supported()`.
+    */
+    template <class T>
+    CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2 __m256i BroadcastAvx2(const T value)
+    {
+        if constexpr (sizeof(T) == 1) { return _mm256_set1_epi8(static_cast<char>(value)); }
+        else if constexpr (sizeof(T) == 2) { return _mm256_set1_epi16(static_cast<short>(value)); }
+        else if constexpr (sizeof(T) == 4) { return _mm256_set1_epi32(static_cast<int>(value)); }
+        else { return _mm256_set1_epi64x(static_cast<long long>(value)); }
+    }
+
+    template <class T>
+    CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2 __m256i CompareEqualAvx2(const __m256i lhs, const __m256i rhs)
+    {
+        if constexpr (sizeof(T) == 1) { return _mm256_cmpeq_epi8(lhs, rhs); }
+        else if constexpr (sizeof(T) == 2) { return _mm256_cmpeq_epi16(lhs, rhs); }
+        else if constexpr (sizeof(T) == 4) { return _mm256_cmpeq_epi32(lhs, rhs); }
+        else { return _mm256_cmpeq_epi64(lhs, rhs); }
+    }
+
+    template <class T>
+    CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2 std::size_t FindValueAvx2(const T* const data, const std::size_t count, const T value)
+    {
+        constexpr std::size_t laneCount = sizeof(__m256i) / sizeof(T);
+
+        const __m256i needle = BroadcastAvx2(value);
+        std::size_t i = 0;
+
+        // Test four vectors per branch, then locate the match within them.
+        for (; i + 4 * laneCount <= count; i += 4 * laneCount)
+        {
+            const __m256i* const lanes = reinterpret_cast<const __m256i*>(data + i);
+            const __m256i matches0 = CompareEqualAvx2<T>(_mm256_loadu_si256(lanes + 0), needle);
+            const __m256i matches1 = CompareEqualAvx2<T>(_mm256_loadu_si256(lanes + 1), needle);
+            const __m256i matches2 = CompareEqualAvx2<T>(_mm256_loadu_si256(lanes + 2), needle);
+            const __m256i matches3 = CompareEqualAvx2<T>(_mm256_loadu_si256(lanes + 3), needle);
+            const __m256i anyMatches = _mm256_or_si256(_mm256_or_si256(matches0, matches1), _mm256_or_si256(matches2, matches3));
+            if (!_mm256_testz_si256(anyMatches, anyMatches))
+            {
+                const __m256i matches[4] = { matches0, matches1, matches2, matches3 };
+                for (std::size_t vector = 0; vector < 4; ++vector)
+                {
+                    const unsigned int matchMask = static_cast<unsigned int>(_mm256_movemask_epi8(matches[vector]));
+                    if (matchMask != 0)
+                    {
+                        return i + vector * laneCount + static_cast<std::size_t>(std::countr_zero(matchMask)) / sizeof(T);
+                    }
+                }
+            }
+        }
+
+        for (; i + laneCount <= count; i += laneCount)
+        {
+            const __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            const unsigned int matchMask = static_cast<unsigned int>(_mm256_movemask_epi8(CompareEqualAvx2<T>(lanes, needle)));
+            if (matchMask != 0)
+            {
+                return i + static_cast<std::size_t>(std::countr_zero(matchMask)) / sizeof(T);
+            }
+        }
+
+        return i + FindValueScalar(data + i, count - i, value);
+    }
+
+    template <class T>
+    CPPUTILS_CONTAINERALGORITHMS_TARGET_AVX2 std::size_t CountValueAvx2(const T* const data, const std::size_t count, const T value)
+    {
+        constexpr std::size_t laneCount = sizeof(__m256i) / sizeof(T);
+
+        const __m256i needle = BroadcastAvx2(value);
+        std::size_t matchByteCount = 0;
+        std::size_t i = 0;
+        for (; i + laneCount <= count; i += laneCount)
+        {
+            const __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            matchByteCount += static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_epi8(CompareEqualAvx2<T>(lanes, needle)))));
+        }
+        return matchByteCount / sizeof(T) + CountValueScalar(data + i, count - i, value);
+    }
+#endif
+
+    template <class T>
+    std::size_t FindValueContiguous(const T* const data, const std::size_t count, const T value)
+    {
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+        return IsAvx2Supported() ? FindValueAvx2(data, count, value) : FindValueSse2(data, count, value);
+#else
+        return FindValueScalar(data, count, value);
+#endif
+    }
+
+    template <class T>
+    std::size_t CountValueContiguous(const T* const data, const std::size_t count, const T value)
+    {
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+        return IsAvx2Supported() ? CountValueAvx2(data, count, value) : CountValueSse2(data, count, value);
+#else
+        return CountValueScalar(data, count, value);
+#endif
+    }
+
+    /*
+    * Whether a search can run on the container's raw lanes.
+    */
+    template <class ContainerType, class ValueType>
+    concept IsSimdSearchable =
+        IsContiguousContainer<ContainerType>
+        && IsSimdScannable<ContainerValueType_t<ContainerType>>
+        && std::is_integral_v<ValueType>;
+
+    /*
+    * Converts the searched value to the element type. Returns nothing if no element could compare equal to it, which
+    * happens when the conversion changes the value (e.g. searching for 300 among `std::uint8_t`s).
+    */
+    template <class ElementValueType, class ValueType>
+    constexpr std::optional<ElementValueType> ToLaneValue(const ValueType& value)
+    {
+        const ElementValueType laneValue = static_cast<ElementValueType>(value);
+        if constexpr (!std::is_same_v<ElementValueType, ValueType>)
+        {
+            if (!(laneValue == value))
+            {
+                return std::nullopt;
+            }
+        }
+        return laneValue;
+    }
+}
+
+/*
+* Linear searches for a value in any container.
+*
+* Contiguous storage (`GetData`) of 8/16/32/64-bit integral elements is scanned with SIMD compares on x86-64 (AVX2 when
+* the CPU supports it, otherwise SSE2). Other containers are scanned element by element through `GetElement`.
+*/
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Returns the index of the first element equal to the value, if any.
+    */
+    template <class ContainerType, class ValueType>
+    constexpr std::optional<std::size_t> FindValue(const ContainerType& container, const ValueType& value)
+    {
+        const std::size_t size = ContainerOps::GetSize{container}.Do();
+
+        if constexpr (Detail::IsSimdSearchable<ContainerType, ValueType>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::optional<Detail::ContainerValueType_t<ContainerType>> laneValue = Detail::ToLaneValue<Detail::ContainerValueType_t<ContainerType>>(value);
+                if (!laneValue || size == 0)
+                {
+                    return std::nullopt;
+                }
+
+                const std::size_t index = Detail::FindValueContiguous(ContainerOps::GetData{container}.Do(), size, *laneValue);
+                return index != size ? std::optional<std::size_t>(index) : std::nullopt;
+            }
+        }
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (ContainerOps::GetElement{container}.Do(i) == value)
+            {
+                return i;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /*
+    * Returns the number of elements equal to the value.
+    */
+    template <class ContainerType, class ValueType>
+    constexpr std::size_t CountValue(const ContainerType& container, const ValueType& value)
+    {
+        const std::size_t size = ContainerOps::GetSize{container}.Do();
+
+        if constexpr (Detail::IsSimdSearchable<ContainerType, ValueType>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::optional<Detail::ContainerValueType_t<ContainerType>> laneValue = Detail::ToLaneValue<Detail::ContainerValueType_t<ContainerType>>(value);
+                if (!laneValue || size == 0)
+                {
+                    return 0;
+                }
+
+                return Detail::CountValueContiguous(ContainerOps::GetData{container}.Do(), size, *laneValue);
+            }
+        }
+
+        std::size_t matchCount = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (ContainerOps::GetElement{container}.Do(i) == value)
+            {
+                ++matchCount;
+            }
+        }
+
+        return matchCount;
+    }
+
+    /*
+    * Whether any element is equal to the value.
+    */
+    template <class ContainerType, class ValueType>
+    constexpr bool ContainsValue(const ContainerType& container, const ValueType& value)
+    {
+        return FindValue(container, value).has_value();
+    }
+}
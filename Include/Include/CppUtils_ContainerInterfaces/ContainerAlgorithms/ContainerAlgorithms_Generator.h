@@ -0,0 +1,145 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Lazily produced sequence of values, from a coroutine that `co_yield`s them. Only one pass over it is possible.
+    *
+    * Yielded values aren't copied. Each stays alive until the coroutine resumes, i.e. until the iterator is incremented.
+    * Exceptions thrown by the coroutine propagate out of `begin` or the increment that resumed it.
+    */
+    template <class T>
+    class Generator
+    {
+    public:
+
+        struct promise_type
+        {
+            Generator get_return_object() { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+
+            std::suspend_always yield_value(const T& value) noexcept
+            {
+                Value = std::addressof(value);
+                return {};
+            }
+
+            void return_void() noexcept {}
+            void unhandled_exception() { Exception = std::current_exception(); }
+
+            // Generators can only yield.
+            template <class AwaitableType>
+            std::suspend_never await_transform(AwaitableType&&) = delete;
+
+            const T* Value = nullptr;
+            std::exception_ptr Exception;
+        };
+
+        using HandleType = std::coroutine_handle<promise_type>;
+
+        class Iterator
+        {
+        public:
+
+            using value_type = T;
+            using reference = const T&;
+            using pointer = const T*;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::input_iterator_tag;
+
+            Iterator() = default;
+
+            explicit Iterator(const HandleType handle)
+                : m_Handle(handle)
+            {
+            }
+
+            reference operator*() const { return *m_Handle.promise().Value; }
+            pointer operator->() const { return m_Handle.promise().Value; }
+
+            Iterator& operator++()
+            {
+                Resume(m_Handle);
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            bool operator==(std::default_sentinel_t) const { return m_Handle.done(); }
+
+        private:
+
+            HandleType m_Handle;
+        };
+
+        Generator(Generator&& other) noexcept
+            : m_Handle(std::exchange(other.m_Handle, nullptr))
+        {
+        }
+
+        Generator& operator=(Generator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Destroy();
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~Generator()
+        {
+            Destroy();
+        }
+
+        /*
+        * Runs the coroutine up to its first value. Only call once.
+        */
+        Iterator begin()
+        {
+            Resume(m_Handle);
+            return Iterator(m_Handle);
+        }
+
+        std::default_sentinel_t end() const { return {}; }
+
+    private:
+
+        explicit Generator(const HandleType handle)
+            : m_Handle(handle)
+        {
+        }
+
+        static void Resume(const HandleType handle)
+        {
+            handle.resume();
+            if (handle.promise().Exception)
+            {
+                std::rethrow_exception(std::exchange(handle.promise().Exception, nullptr));
+            }
+        }
+
+        void Destroy()
+        {
+            if (m_Handle)
+            {
+                m_Handle.destroy();
+            }
+        }
+
+        // Null once moved from.
+        HandleType m_Handle;
+    };
+}
@@ -0,0 +1,183 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Traits.h>
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#   include <intrin.h>
+#endif
+
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+    inline constexpr std::uint64_t HashSecret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+    /*
+    * 64x64 -> 128 bit multiply, folded back to 64 bits. This is the mixing primitive of the hash.
+    */
+    inline std::uint64_t MultiplyFold(const std::uint64_t a, const std::uint64_t b)
+    {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+        std::uint64_t high;
+        const std::uint64_t low = _umul128(a, b, &high);
+        return low ^ high;
+#else
+        const std::uint64_t aHigh = a >> 32, aLow = static_cast<std::uint32_t>(a);
+        const std::uint64_t bHigh = b >> 32, bLow = static_cast<std::uint32_t>(b);
+        const std::uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+        const std::uint64_t carry = ((lowLow >> 32) + static_cast<std::uint32_t>(lowHigh) + static_cast<std::uint32_t>(highLow)) >> 32;
+        const std::uint64_t low = lowLow + (lowHigh << 32) + (highLow << 32);
+        const std::uint64_t high = highHigh + (lowHigh >> 32) + (highLow >> 32) + carry;
+        return low ^ high;
+#endif
+    }
+
+    inline std::uint64_t Read64(const unsigned char* bytes)
+    {
+        std::uint64_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    inline std::uint64_t Read32(const unsigned char* bytes)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+}
+
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Fast non-cryptographic 64-bit hash of a byte range (wyhash construction). Inputs over 48 bytes are consumed
+    * in three independent lanes to keep the multipliers busy. Values depend on the platform's byte order.
+    */
+    inline std::uint64_t HashBytes(const void* data, const std::size_t length, std::uint64_t seed = 0)
+    {
+        using Detail::HashSecret;
+        using Detail::MultiplyFold;
+        using Detail::Read32;
+        using Detail::Read64;
+
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        seed ^= MultiplyFold(seed ^ HashSecret[0], HashSecret[1]);
+
+        std::uint64_t a = 0;
+        std::uint64_t b = 0;
+        if (length <= 16)
+        {
+            if (length >= 4)
+            {
+                const std::size_t middleOffset = (length >> 3) << 2;
+                a = (Read32(bytes) << 32) | Read32(bytes + middleOffset);
+                b = (Read32(bytes + length - 4) << 32) | Read32(bytes + length - 4 - middleOffset);
+            }
+            else if (length > 0)
+            {
+                a = (static_cast<std::uint64_t>(bytes[0]) << 16) | (static_cast<std::uint64_t>(bytes[length >> 1]) << 8) | bytes[length - 1];
+            }
+        }
+        else
+        {
+            std::size_t remaining = length;
+            if (remaining > 48)
+            {
+                std::uint64_t lane1 = seed;
+                std::uint64_t lane2 = seed;
+                do
+                {
+                    seed = MultiplyFold(Read64(bytes) ^ HashSecret[1], Read64(bytes + 8) ^ seed);
+                    lane1 = MultiplyFold(Read64(bytes + 16) ^ HashSecret[2], Read64(bytes + 24) ^ lane1);
+                    lane2 = MultiplyFold(Read64(bytes + 32) ^ HashSecret[3], Read64(bytes + 40) ^ lane2);
+                    bytes += 48;
+                    remaining -= 48;
+                }
+                while (remaining > 48);
+                seed ^= lane1 ^ lane2;
+            }
+
+            while (remaining > 16)
+            {
+                seed = MultiplyFold(Read64(bytes) ^ HashSecret[1], Read64(bytes + 8) ^ seed);
+                bytes += 16;
+                remaining -= 16;
+            }
+
+            a = Read64(bytes + remaining - 16);
+            b = Read64(bytes + remaining - 8);
+        }
+
+        return MultiplyFold(HashSecret[1] ^ length, MultiplyFold(a ^ HashSecret[1], b ^ seed));
+    }
+
+    /*
+    * Hashes the container's size and elements.
+    *
+    * Contiguous storage of elements with unique object representations is hashed as one byte range. Otherwise,
+    * each element is hashed (recursively for nested containers, via `std::hash` for other types) and combined.
+    * The two paths produce different values for the same elements, so don't mix container types that take
+    * different paths within one key space.
+    */
+    template <class ContainerType>
+    std::uint64_t Hash(const ContainerType& container, const std::uint64_t seed = 0)
+    {
+        using ElementValueType = Detail::ContainerValueType_t<ContainerType>;
+
+        const std::size_t size = ContainerOps::GetSize{container}.Do();
+
+        if constexpr (Detail::IsContiguousContainer<ContainerType> && std::has_unique_object_representations_v<ElementValueType>)
+        {
+            return HashBytes(ContainerOps::GetData{container}.Do(), size * sizeof(ElementValueType), seed);
+        }
+        else
+        {
+            std::uint64_t hash = Detail::MultiplyFold(seed ^ Detail::HashSecret[0], size ^ Detail::HashSecret[1]);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const ElementValueType& element = ContainerOps::GetElement{container}.Do(i);
+
+                std::uint64_t elementHash;
+                if constexpr (ContainerOps::Detail::IsContainerOpImplemented<ContainerOps::Detail::ContainerOp_GetSize, ElementValueType>)
+                {
+                    elementHash = Hash(element, seed);
+                }
+                else if constexpr (std::has_unique_object_representations_v<ElementValueType>)
+                {
+                    elementHash = HashBytes(&element, sizeof(element), seed);
+                }
+                else
+                {
+                    elementHash = std::hash<ElementValueType>{}(element);
+                }
+
+                hash = Detail::MultiplyFold(hash ^ Detail::HashSecret[2], elementHash ^ Detail::HashSecret[3]);
+            }
+            return hash;
+        }
+    }
+
+    /*
+    * Hash functor over containers, e.g. for keying hash maps by container contents.
+    *
+    * Not transparent: containers of other types can hash differently even when they compare equal (see `Hash`), so
+    * lookups must use the key type.
+    */
+    struct ContainerHasher
+    {
+        template <class ContainerType>
+        std::size_t operator()(const ContainerType& container) const
+        {
+            return static_cast<std::size_t>(Hash(container));
+        }
+    };
+}
@@ -0,0 +1,38 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <CppUtils/Misc/ContainerElementType.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Returns the container's memory footprint including the allocations of its elements, for containers of containers.
+    *
+    * Elements are recursed into when their type implements the `GetMemoryUsage` op. Only their heap and slack bytes
+    * are added, since their inline bytes already live within the outer container's storage.
+    */
+    template <class ContainerType>
+    constexpr ContainerOps::ContainerMemoryUsage GetMemoryUsageRecursive(const ContainerType& container)
+    {
+        using ElementType = std::remove_cvref_t<ContainerElementType_t<ContainerType>>;
+
+        ContainerOps::ContainerMemoryUsage usage = ContainerOps::GetMemoryUsage{container}.Do();
+
+        if constexpr (ContainerOps::Detail::IsContainerOpImplemented<ContainerOps::Detail::ContainerOp_GetMemoryUsage, ElementType>)
+        {
+            const std::size_t size = ContainerOps::GetSize{container}.Do();
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const ContainerOps::ContainerMemoryUsage elementUsage = GetMemoryUsageRecursive(ContainerOps::GetElement{container}.Do(i));
+                usage.HeapBytes += elementUsage.HeapBytes;
+                usage.SlackBytes += elementUsage.SlackBytes;
+            }
+        }
+
+        return usage;
+    }
+}
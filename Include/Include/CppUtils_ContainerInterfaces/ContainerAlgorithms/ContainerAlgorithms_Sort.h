@@ -0,0 +1,598 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerOpIterator.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Traits.h>
+
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Below this many elements, radix sorting isn't worth its histogram and scratch buffer.
+    */
+    inline constexpr std::size_t RadixSortThreshold = 256;
+
+    /*
+    * From this many elements, contiguous storage is sorted in chunks on multiple threads and then merged.
+    */
+    inline constexpr std::size_t ParallelSortThreshold = std::size_t{1} << 20;
+}
+
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+    /*
+    * Whether the comparator is plain `operator<`, so that the element's natural order may be assumed.
+    */
+    template <class CompareType, class T>
+    concept IsDefaultLess =
+        std::is_same_v<CompareType, std::less<>>
+        || std::is_same_v<CompareType, std::less<T>>
+        || std::is_same_v<CompareType, std::ranges::less>;
+
+    /*
+    * Whether elements can be sorted by the bytes of an order-preserving unsigned key.
+    */
+    template <class T>
+    concept IsRadixSortable =
+        (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+        || (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8));
+
+    template <class T>
+    using RadixKey_t = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+        std::conditional_t<sizeof(T) == 2, std::uint16_t,
+        std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+    /*
+    * Maps the value to an unsigned key with the same ordering. Signed integers get their sign bit flipped. IEEE floats
+    * get their sign bit flipped if positive, or all bits flipped if negative. NaNs order after +inf (or before -inf).
+    */
+    template <class T>
+    RadixKey_t<T> ToRadixKey(const T value)
+    {
+        using KeyType = RadixKey_t<T>;
+        constexpr KeyType signBit = KeyType{1} << (sizeof(T) * 8 - 1);
+
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            const KeyType bits = std::bit_cast<KeyType>(value);
+            return bits ^ ((bits & signBit) ? static_cast<KeyType>(~KeyType{0}) : signBit);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            return static_cast<KeyType>(static_cast<KeyType>(value) ^ signBit);
+        }
+        else
+        {
+            return static_cast<KeyType>(value);
+        }
+    }
+
+    /*
+    * Stable LSD radix sort with 8-bit digits. All digit histograms are counted in one read pass, and passes whose digit
+    * is the same for every element (common for ids that only use their low bytes) are skipped.
+    */
+    template <class T>
+    void RadixSort(T* const first, T* const last)
+    {
+        constexpr std::size_t passCount = sizeof(T);
+
+        const std::size_t count = static_cast<std::size_t>(last - first);
+        if (count < 2)
+        {
+            return;
+        }
+
+        std::unique_ptr<std::size_t[]> histograms = std::make_unique<std::size_t[]>(passCount * 256);
+        for (const T* element = first; element != last; ++element)
+        {
+            const RadixKey_t<T> key = ToRadixKey(*element);
+            for (std::size_t pass = 0; pass < passCount; ++pass)
+            {
+                ++histograms[pass * 256 + ((key >> (pass * 8)) & 0xFF)];
+            }
+        }
+
+        std::unique_ptr<T[]> scratch = std::make_unique_for_overwrite<T[]>(count);
+        T* source = first;
+        T* destination = scratch.get();
+
+        for (std::size_t pass = 0; pass < passCount; ++pass)
+        {
+            std::size_t* const histogram = histograms.get() + pass * 256;
+
+            const std::size_t firstDigit = (ToRadixKey(*source) >> (pass * 8)) & 0xFF;
+            if (histogram[firstDigit] == count)
+            {
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (std::size_t digit = 0; digit < 256; ++digit)
+            {
+                const std::size_t digitCount = histogram[digit];
+                histogram[digit] = offset;
+                offset += digitCount;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::size_t digit = (ToRadixKey(source[i]) >> (pass * 8)) & 0xFF;
+                destination[histogram[digit]++] = source[i];
+            }
+
+            std::swap(source, destination);
+        }
+
+        if (source != first)
+        {
+            std::memcpy(first, source, count * sizeof(T));
+        }
+    }
+
+    /*
+    * Pattern-defeating quicksort (after Orson Peters' pdqsort). Quicksort with median-of-3 (ninther for large ranges)
+    * pivots, which detects already partitioned ranges and finishes them with a bounded insertion sort, shuffles on
+    * unbalanced partitions, puts runs equal to the previous pivot aside, and falls back to heapsort in the worst case.
+    */
+    namespace PdqSort
+    {
+        inline constexpr std::ptrdiff_t InsertionSortThreshold = 24;
+        inline constexpr std::ptrdiff_t NintherThreshold = 128;
+        inline constexpr std::ptrdiff_t PartialInsertionSortLimit = 8;
+
+        template <class IteratorType, class CompareType>
+        void InsertionSort(const IteratorType first, const IteratorType last, CompareType& compare)
+        {
+            using ValueType = std::iter_value_t<IteratorType>;
+
+            if (first == last)
+            {
+                return;
+            }
+
+            for (IteratorType current = first + 1; current != last; ++current)
+            {
+                IteratorType sift = current;
+                IteratorType siftPrevious = current - 1;
+                if (compare(*sift, *siftPrevious))
+                {
+                    ValueType value = std::move(*sift);
+                    do
+                    {
+                        *sift-- = std::move(*siftPrevious);
+                    }
+                    while (sift != first && compare(value, *--siftPrevious));
+                    *sift = std::move(value);
+                }
+            }
+        }
+
+        /*
+        * Insertion sort that relies on the element before `first` being no greater than any element in the range.
+        */
+        template <class IteratorType, class CompareType>
+        void UnguardedInsertionSort(const IteratorType first, const IteratorType last, CompareType& compare)
+        {
+            using ValueType = std::iter_value_t<IteratorType>;
+
+            if (first == last)
+            {
+                return;
+            }
+
+            for (IteratorType current = first + 1; current != last; ++current)
+            {
+                IteratorType sift = current;
+                IteratorType siftPrevious = current - 1;
+                if (compare(*sift, *siftPrevious))
+                {
+                    ValueType value = std::move(*sift);
+                    do
+                    {
+                        *sift-- = std::move(*siftPrevious);
+                    }
+                    while (compare(value, *--siftPrevious));
+                    *sift = std::move(value);
+                }
+            }
+        }
+
+        /*
+        * Insertion sort that gives up, returning false, once it has moved more than a few elements.
+        */
+        template <class IteratorType, class CompareType>
+        bool PartialInsertionSort(const IteratorType first, const IteratorType last, CompareType& compare)
+        {
+            using ValueType = std::iter_value_t<IteratorType>;
+
+            if (first == last)
+            {
+                return true;
+            }
+
+            std::ptrdiff_t movedCount = 0;
+            for (IteratorType current = first + 1; current != last; ++current)
+            {
+                IteratorType sift = current;
+                IteratorType siftPrevious = current - 1;
+                if (compare(*sift, *siftPrevious))
+                {
+                    ValueType value = std::move(*sift);
+                    do
+                    {
+                        *sift-- = std::move(*siftPrevious);
+                    }
+                    while (sift != first && compare(value, *--siftPrevious));
+                    *sift = std::move(value);
+                    movedCount += current - sift;
+                }
+
+                if (movedCount > PartialInsertionSortLimit)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template <class IteratorType, class CompareType>
+        void Sort2(const IteratorType a, const IteratorType b, CompareType& compare)
+        {
+            if (compare(*b, *a))
+            {
+                std::iter_swap(a, b);
+            }
+        }
+
+        template <class IteratorType, class CompareType>
+        void Sort3(const IteratorType a, const IteratorType b, const IteratorType c, CompareType& compare)
+        {
+            Sort2(a, b, compare);
+            Sort2(b, c, compare);
+            Sort2(a, b, compare);
+        }
+
+        /*
+        * Partitions around the pivot at `first`, with elements equal to it going right. Returns the pivot's final
+        * position and whether the range was already partitioned.
+        */
+        template <class IteratorType, class CompareType>
+        std::pair<IteratorType, bool> PartitionRight(const IteratorType first, const IteratorType last, CompareType& compare)
+        {
+            using ValueType = std::iter_value_t<IteratorType>;
+
+            ValueType pivot = std::move(*first);
+            IteratorType left = first;
+            IteratorType right = last;
+
+            while (compare(*++left, pivot));
+
+            if (left - 1 == first)
+            {
+                while (left < right && !compare(*--right, pivot));
+            }
+            else
+            {
+                while (!compare(*--right, pivot));
+            }
+
+            const bool bAlreadyPartitioned = left >= right;
+
+            while (left < right)
+            {
+                std::iter_swap(left, right);
+                while (compare(*++left, pivot));
+                while (!compare(*--right, pivot));
+            }
+
+            const IteratorType pivotPosition = left - 1;
+            *first = std::move(*pivotPosition);
+            *pivotPosition = std::move(pivot);
+            return { pivotPosition, bAlreadyPartitioned };
+        }
+
+        /*
+        * Partitions around the pivot at `first`, with elements equal to it going left. Used when the pivot equals the
+        * previous partition's pivot, so the whole left side is a run of equal elements that needs no further sorting.
+        */
+        template <class IteratorType, class CompareType>
+        IteratorType PartitionLeft(const IteratorType first, const IteratorType last, CompareType& compare)
+        {
+            using ValueType = std::iter_value_t<IteratorType>;
+
+            ValueType pivot = std::move(*first);
+            IteratorType left = first;
+            IteratorType right = last;
+
+            while (compare(pivot, *--right));
+
+            if (right + 1 == last)
+            {
+                while (left < right && !compare(pivot, *++left));
+            }
+            else
+            {
+                while (!compare(pivot, *++left));
+            }
+
+            while (left < right)
+            {
+                std::iter_swap(left, right);
+                while (compare(pivot, *--right));
+                while (!compare(pivot, *++left));
+            }
+
+            const IteratorType pivotPosition = right;
+            *first = std::move(*pivotPosition);
+            *pivotPosition = std::move(pivot);
+            return pivotPosition;
+        }
+
+        template <class IteratorType, class CompareType>
+        void SortLoop(IteratorType first, const IteratorType last, CompareType& compare, int badPartitionsAllowed, bool bLeftmost)
+        {
+            while (true)
+            {
+                const std::ptrdiff_t size = last - first;
+
+                if (size < InsertionSortThreshold)
+                {
+                    if (bLeftmost)
+                    {
+                        InsertionSort(first, last, compare);
+                    }
+                    else
+                    {
+                        UnguardedInsertionSort(first, last, compare);
+                    }
+                    return;
+                }
+
+                const std::ptrdiff_t half = size / 2;
+                if (size > NintherThreshold)
+                {
+                    Sort3(first, first + half, last - 1, compare);
+                    Sort3(first + 1, first + (half - 1), last - 2, compare);
+                    Sort3(first + 2, first + (half + 1), last - 3, compare);
+                    Sort3(first + (half - 1), first + half, first + (half + 1), compare);
+                    std::iter_swap(first, first + half);
+                }
+                else
+                {
+                    Sort3(first + half, first, last - 1, compare);
+                }
+
+                // Nothing in this range is less than the element before it. So if the pivot equals that element, the
+                // pivot's equal elements can all be put aside on the left without sorting them.
+                if (!bLeftmost && !compare(*(first - 1), *first))
+                {
+                    first = PartitionLeft(first, last, compare) + 1;
+                    continue;
+                }
+
+                const auto [pivotPosition, bAlreadyPartitioned] = PartitionRight(first, last, compare);
+
+                const std::ptrdiff_t leftSize = pivotPosition - first;
+                const std::ptrdiff_t rightSize = last - (pivotPosition + 1);
+                const bool bHighlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+                if (bHighlyUnbalanced)
+                {
+                    if (--badPartitionsAllowed == 0)
+                    {
+                        std::make_heap(first, last, compare);
+                        std::sort_heap(first, last, compare);
+                        return;
+                    }
+
+                    // Break up patterns that produce bad pivots.
+                    if (leftSize >= InsertionSortThreshold)
+                    {
+                        std::iter_swap(first, first + leftSize / 4);
+                        std::iter_swap(pivotPosition - 1, pivotPosition - leftSize / 4);
+                        if (leftSize > NintherThreshold)
+                        {
+                            std::iter_swap(first + 1, first + (leftSize / 4 + 1));
+                            std::iter_swap(first + 2, first + (leftSize / 4 + 2));
+                            std::iter_swap(pivotPosition - 2, pivotPosition - (leftSize / 4 + 1));
+                            std::iter_swap(pivotPosition - 3, pivotPosition - (leftSize / 4 + 2));
+                        }
+                    }
+
+                    if (rightSize >= InsertionSortThreshold)
+                    {
+                        std::iter_swap(pivotPosition + 1, pivotPosition + (1 + rightSize / 4));
+                        std::iter_swap(last - 1, last - rightSize / 4);
+                        if (rightSize > NintherThreshold)
+                        {
+                            std::iter_swap(pivotPosition + 2, pivotPosition + (2 + rightSize / 4));
+                            std::iter_swap(pivotPosition + 3, pivotPosition + (3 + rightSize / 4));
+                            std::iter_swap(last - 2, last - (1 + rightSize / 4));
+                            std::iter_swap(last - 3, last - (2 + rightSize / 4));
+                        }
+                    }
+                }
+                else if (bAlreadyPartitioned
+                    && PartialInsertionSort(first, pivotPosition, compare)
+                    && PartialInsertionSort(pivotPosition + 1, last, compare))
+                {
+                    return;
+                }
+
+                // Recurse into the left side and loop on the right side.
+                SortLoop(first, pivotPosition, compare, badPartitionsAllowed, bLeftmost);
+                first = pivotPosition + 1;
+                bLeftmost = false;
+            }
+        }
+
+        template <class IteratorType, class CompareType>
+        void Sort(const IteratorType first, const IteratorType last, CompareType& compare)
+        {
+            const std::ptrdiff_t size = last - first;
+            if (size < 2)
+            {
+                return;
+            }
+
+            SortLoop(first, last, compare, std::bit_width(static_cast<std::size_t>(size)), true);
+        }
+    }
+
+    /*
+    * Sorts a contiguous range on a single thread, picking radix sort where it applies.
+    */
+    template <bool bStable, class T, class CompareType>
+    void SortContiguousRange(T* const first, T* const last, CompareType& compare)
+    {
+        // Radix sort orders -0.0 before +0.0, which the default comparator considers equal. So it's only stable for integers.
+        if constexpr (IsRadixSortable<T> && IsDefaultLess<CompareType, T> && (!bStable || std::is_integral_v<T>))
+        {
+            if (static_cast<std::size_t>(last - first) >= RadixSortThreshold)
+            {
+                RadixSort(first, last);
+                return;
+            }
+        }
+
+        if constexpr (bStable)
+        {
+            std::stable_sort(first, last, compare);
+        }
+        else
+        {
+            PdqSort::Sort(first, last, compare);
+        }
+    }
+
+    /*
+    * Sorts a contiguous range, splitting large ranges into one chunk per hardware thread. Chunks are sorted concurrently,
+    * then merged pairwise (also concurrently) with a stable merge, so the result is stable if the chunk sort is.
+    */
+    template <bool bStable, class T, class CompareType>
+    void SortContiguous(T* const first, T* const last, CompareType& compare)
+    {
+        const std::size_t count = static_cast<std::size_t>(last - first);
+        const std::size_t threadCount = std::min<std::size_t>(std::thread::hardware_concurrency(), count / (ParallelSortThreshold / 8));
+
+        if (count < ParallelSortThreshold || threadCount < 2)
+        {
+            SortContiguousRange<bStable>(first, last, compare);
+            return;
+        }
+
+        std::vector<T*> bounds;
+        bounds.reserve(threadCount + 1);
+        for (std::size_t i = 0; i <= threadCount; ++i)
+        {
+            bounds.push_back(first + count * i / threadCount);
+        }
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(threadCount - 1);
+            for (std::size_t i = 1; i < threadCount; ++i)
+            {
+                workers.emplace_back([&bounds, &compare, i]() { SortContiguousRange<bStable>(bounds[i], bounds[i + 1], compare); });
+            }
+            SortContiguousRange<bStable>(bounds[0], bounds[1], compare);
+        }
+
+        while (bounds.size() > 2)
+        {
+            std::vector<T*> mergedBounds;
+            mergedBounds.reserve(bounds.size() / 2 + 2);
+
+            std::vector<std::jthread> workers;
+            workers.reserve(bounds.size() / 2);
+            for (std::size_t i = 0; i + 2 < bounds.size(); i += 2)
+            {
+                mergedBounds.push_back(bounds[i]);
+                workers.emplace_back([&compare, chunkFirst = bounds[i], chunkMiddle = bounds[i + 1], chunkLast = bounds[i + 2]]()
+                    {
+                        std::inplace_merge(chunkFirst, chunkMiddle, chunkLast, compare);
+                    });
+            }
+            if (bounds.size() % 2 == 0)
+            {
+                // Odd number of chunks. The last one has no partner this round.
+                mergedBounds.push_back(bounds[bounds.size() - 2]);
+            }
+            mergedBounds.push_back(bounds.back());
+
+            workers.clear();
+            bounds = std::move(mergedBounds);
+        }
+    }
+
+    template <bool bStable, class ContainerType, class CompareType>
+    void SortContainer(ContainerType& container, CompareType& compare)
+    {
+        const std::size_t size = ContainerOps::GetSize{container}.Do();
+        if (size < 2)
+        {
+            return;
+        }
+
+        if constexpr (IsContiguousContainer<ContainerType>)
+        {
+            auto* const data = ContainerOps::GetData{container}.Do();
+            SortContiguous<bStable>(data, data + size, compare);
+        }
+        else
+        {
+            const ContainerOps::ContainerOpIterator<ContainerType> first(container, 0);
+            const ContainerOps::ContainerOpIterator<ContainerType> last(container, size);
+
+            if constexpr (bStable)
+            {
+                std::stable_sort(first, last, compare);
+            }
+            else
+            {
+                PdqSort::Sort(first, last, compare);
+            }
+        }
+    }
+}
+
+/*
+* In-place sorting of any container with `GetSize` and mutable `GetElement` ops.
+*
+* Contiguous storage (`GetData`) of integral or IEEE float elements, sorted with the default comparator, is LSD radix
+* sorted (only integral elements for `StableSort`). Other contiguous storage is pattern-defeating quicksorted, or `std::stable_sort`ed for `StableSort`. From
+* `ParallelSortThreshold` elements, contiguous storage is sorted on multiple threads. Non-contiguous containers are
+* sorted on one thread through `GetElement`.
+*/
+namespace CppUtils::ContainerAlgorithms
+{
+    template <class ContainerType, class CompareType = std::less<>>
+    void Sort(ContainerType& container, CompareType compare = {})
+    {
+        Detail::SortContainer<false>(container, compare);
+    }
+
+    /*
+    * Like `Sort`, but keeps equal elements in their original order.
+    */
+    template <class ContainerType, class CompareType = std::less<>>
+    void StableSort(ContainerType& container, CompareType compare = {})
+    {
+        Detail::SortContainer<true>(container, compare);
+    }
+}
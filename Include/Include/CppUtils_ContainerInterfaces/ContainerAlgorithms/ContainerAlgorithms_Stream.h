@@ -0,0 +1,235 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Traits.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Generator.h>
+
+namespace CppUtils::ContainerAlgorithms
+{
+    /*
+    * Small fixed pool of worker threads running submitted tasks in submission order (per worker). Destruction finishes the
+    * queued tasks first. There's always at least one worker, so a thread count of zero gets one.
+    */
+    class StreamExecutor
+    {
+    public:
+
+        explicit StreamExecutor(const std::size_t threadCount = 1)
+        {
+            const std::size_t workerCount = std::max<std::size_t>(threadCount, 1);
+            m_Workers.reserve(workerCount);
+            for (std::size_t i = 0; i < workerCount; ++i)
+            {
+                m_Workers.emplace_back([this]() { RunWorker(); });
+            }
+        }
+
+        StreamExecutor(const StreamExecutor&) = delete;
+        StreamExecutor& operator=(const StreamExecutor&) = delete;
+
+        ~StreamExecutor()
+        {
+            {
+                const std::lock_guard lock(m_Mutex);
+                m_bIsStopping = true;
+            }
+            m_TaskAvailable.notify_all();
+            for (std::thread& worker : m_Workers)
+            {
+                worker.join();
+            }
+        }
+
+        /*
+        * Queues the task. The future becomes ready once it ran, and rethrows what it threw.
+        */
+        template <class TaskType>
+        std::future<void> Submit(TaskType&& task)
+        {
+            std::packaged_task<void()> packagedTask(std::forward<TaskType>(task));
+            std::future<void> future = packagedTask.get_future();
+            {
+                const std::lock_guard lock(m_Mutex);
+                m_Tasks.push_back(std::move(packagedTask));
+            }
+            m_TaskAvailable.notify_one();
+            return future;
+        }
+
+    private:
+
+        void RunWorker()
+        {
+            while (true)
+            {
+                std::packaged_task<void()> task;
+                {
+                    std::unique_lock lock(m_Mutex);
+                    m_TaskAvailable.wait(lock, [this]() { return m_bIsStopping || !m_Tasks.empty(); });
+                    if (m_Tasks.empty())
+                    {
+                        return;
+                    }
+                    task = std::move(m_Tasks.front());
+                    m_Tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex m_Mutex;
+        std::condition_variable m_TaskAvailable;
+        std::deque<std::packaged_task<void()>> m_Tasks;
+        bool m_bIsStopping = false;
+        std::vector<std::thread> m_Workers;
+    };
+}
+
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+    /*
+    * Task in flight on a `StreamExecutor`, waited for on destruction. Keeps a stream abandoned mid-way from freeing the
+    * chunk a task is still filling.
+    */
+    struct StreamPendingTask
+    {
+        StreamPendingTask() = default;
+        StreamPendingTask(const StreamPendingTask&) = delete;
+        StreamPendingTask& operator=(const StreamPendingTask&) = delete;
+
+        ~StreamPendingTask()
+        {
+            if (Future.valid())
+            {
+                Future.wait();
+            }
+        }
+
+        std::future<void> Future;
+    };
+
+    /*
+    * Copies elements [start, start + count) into the chunk, through the `GetElement` op.
+    */
+    template <class ContainerType, class ValueType>
+    void FillStreamChunk(const ContainerType& container, std::vector<ValueType>& chunk, const std::size_t start, const std::size_t count)
+    {
+        chunk.clear();
+        for (std::size_t i = start; i < start + count; ++i)
+        {
+            chunk.push_back(ContainerOps::GetElement{container}.Do(i));
+        }
+    }
+}
+
+/*
+* Chunked streaming over any container, for pipelining processing over large containers with bounded memory.
+*
+* Chunks are spans of up to `chunkSize` elements, in order. A chunk size of zero is treated as one. Contiguous containers
+* (`GetData`) are streamed in place, without copying. Other containers (e.g. compressed or computed ones) are copied chunk
+* by chunk through `GetElement` into buffers owned by the stream, which are reused, so a chunk is only valid until the
+* next one is requested.
+*
+* The container must outlive the stream, and not change while being streamed.
+*/
+namespace CppUtils::ContainerAlgorithms
+{
+    template <class ContainerType>
+    Generator<std::span<const Detail::ContainerValueType_t<ContainerType>>> StreamChunks(const ContainerType& container, const std::size_t chunkSize)
+    {
+        using ValueType = Detail::ContainerValueType_t<ContainerType>;
+
+        const std::size_t elementsPerChunk = std::max<std::size_t>(chunkSize, 1);
+        const std::size_t size = ContainerOps::GetSize{container}.Do();
+
+        if constexpr (Detail::IsContiguousContainer<ContainerType>)
+        {
+            const ValueType* const data = ContainerOps::GetData{container}.Do();
+            for (std::size_t start = 0; start < size; start += elementsPerChunk)
+            {
+                co_yield std::span<const ValueType>(data + start, std::min(elementsPerChunk, size - start));
+            }
+        }
+        else
+        {
+            std::vector<ValueType> chunk;
+            chunk.reserve(std::min(elementsPerChunk, size));
+            for (std::size_t start = 0; start < size; start += elementsPerChunk)
+            {
+                Detail::FillStreamChunk(container, chunk, start, std::min(elementsPerChunk, size - start));
+                co_yield std::span<const ValueType>(chunk);
+            }
+        }
+    }
+
+    /*
+    * Like `StreamChunks`, but the executor fills the next chunk while the caller consumes the current one. Holds at most
+    * two chunks. Reads of the container happen on the executor's threads, so the container's reads must be safe to make
+    * from another thread.
+    *
+    * Contiguous containers have nothing to produce, so are streamed as by `StreamChunks`. The executor must outlive the
+    * stream.
+    */
+    template <class ContainerType>
+    Generator<std::span<const Detail::ContainerValueType_t<ContainerType>>> StreamChunksAsync(const ContainerType& container, const std::size_t chunkSize, StreamExecutor& executor)
+    {
+        using ValueType = Detail::ContainerValueType_t<ContainerType>;
+
+        if constexpr (Detail::IsContiguousContainer<ContainerType>)
+        {
+            for (const std::span<const ValueType> chunk : StreamChunks(container, chunkSize))
+            {
+                co_yield chunk;
+            }
+        }
+        else
+        {
+            const std::size_t elementsPerChunk = std::max<std::size_t>(chunkSize, 1);
+            const std::size_t size = ContainerOps::GetSize{container}.Do();
+
+            // Declared after the chunks, so destroyed (and waited for) before them.
+            std::array<std::vector<ValueType>, 2> chunks;
+            Detail::StreamPendingTask pendingFill;
+
+            const auto submitFill = [&](std::vector<ValueType>& chunk, const std::size_t start)
+                {
+                    pendingFill.Future = executor.Submit([&container, &chunk, start, count = std::min(elementsPerChunk, size - start)]()
+                        {
+                            Detail::FillStreamChunk(container, chunk, start, count);
+                        });
+                };
+
+            if (size > 0)
+            {
+                submitFill(chunks[0], 0);
+            }
+
+            std::size_t current = 0;
+            for (std::size_t start = 0; start < size; start += elementsPerChunk)
+            {
+                pendingFill.Future.get();
+
+                if (start + elementsPerChunk < size)
+                {
+                    submitFill(chunks[current ^ 1], start + elementsPerChunk);
+                }
+                co_yield std::span<const ValueType>(chunks[current]);
+
+                current ^= 1;
+            }
+        }
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <type_traits>
+#include <CppUtils/Misc/ContainerElementType.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+
+/*
+* Common traits that container algorithms use to select their implementation.
+*/
+namespace CppUtils::ContainerAlgorithms::Detail
+{
+    /*
+    * The container's element type without cv-qualification.
+    */
+    template <class ContainerType>
+    using ContainerValueType_t = std::remove_cvref_t<ContainerElementType_t<std::remove_reference_t<ContainerType>>>;
+
+    /*
+    * Whether the container exposes its elements as contiguous storage via the `GetData` op.
+    */
+    template <class ContainerType>
+    concept IsContiguousContainer = ContainerOps::Detail::IsContainerOpImplemented<ContainerOps::Detail::ContainerOp_GetData, ContainerType>;
+
+    /*
+    * Whether elements can be transferred between the containers' storage with a raw memory copy.
+    */
+    template <class DstContainerType, class SrcContainerType>
+    concept IsBitwiseTransferable =
+        IsContiguousContainer<DstContainerType>
+        && IsContiguousContainer<SrcContainerType>
+        && std::is_same_v<ContainerValueType_t<DstContainerType>, ContainerValueType_t<SrcContainerType>>
+        && std::is_trivially_copyable_v<ContainerValueType_t<DstContainerType>>;
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+
+namespace CppUtils::ContainerOps
+{
+    /*
+    * Memory footprint of a container, in bytes. Returned by the `GetMemoryUsage` op.
+    */
+    struct ContainerMemoryUsage
+    {
+        // Bytes the container has allocated on the heap.
+        std::size_t HeapBytes = 0;
+
+        // Bytes of the container object itself, which includes any elements stored inline.
+        std::size_t InlineBytes = 0;
+
+        // Bytes of allocated element storage that isn't occupied by elements (i.e. capacity beyond size). This is
+        // a portion of `HeapBytes` or `InlineBytes`, not in addition to them.
+        std::size_t SlackBytes = 0;
+
+        constexpr std::size_t GetTotalBytes() const
+        {
+            return HeapBytes + InlineBytes;
+        }
+
+        constexpr ContainerMemoryUsage& operator+=(const ContainerMemoryUsage& other)
+        {
+            HeapBytes += other.HeapBytes;
+            InlineBytes += other.InlineBytes;
+            SlackBytes += other.SlackBytes;
+            return *this;
+        }
+
+        constexpr bool operator==(const ContainerMemoryUsage&) const = default;
+    };
+}
@@ -0,0 +1,221 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+/*
+* Opt-in instrumentation of container ops, enabled by defining `CPPUTILS_CONTAINEROPS_INSTRUMENT`.
+*
+* Every interface constructed on a runtime container records a call against its op and container type in
+* thread-local counters. The `GetCapacity` interface additionally remembers the last capacity it observed for
+* each container, so that capacity changes (i.e. reallocations) between observations get counted.
+*
+* Ops that resolve entirely at compile time (e.g. the capacity of arrays) have no runtime cost, so they aren't counted.
+*
+* When the mode is off, nothing is declared here and the interfaces are exactly as they'd be without this header.
+*/
+#if defined(CPPUTILS_CONTAINEROPS_INSTRUMENT)
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace CppUtils::ContainerOps::Instrumentation
+{
+    /*
+    * Counts recorded for a single op and container type pair.
+    */
+    struct ContainerOpCounter
+    {
+        std::string_view OpName;
+        std::string_view ContainerTypeName;
+        std::uint64_t CallCount = 0;
+        // Only recorded by `GetCapacity`.
+        std::uint64_t CapacityChangeCount = 0;
+    };
+}
+
+namespace CppUtils::ContainerOps::Instrumentation::Detail
+{
+    template <class T>
+    constexpr std::string_view GetRawTypeSignature()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return __FUNCSIG__;
+#else
+        return __PRETTY_FUNCTION__;
+#endif
+    }
+
+    /*
+    * Extracts the name of T out of the compiler's function signature string, using a known type to locate it.
+    */
+    template <class T>
+    constexpr std::string_view GetTypeName()
+    {
+        constexpr std::string_view probeSignature = GetRawTypeSignature<double>();
+        constexpr std::size_t prefixLength = probeSignature.find("double");
+        constexpr std::size_t suffixLength = probeSignature.size() - prefixLength - std::string_view("double").size();
+
+        const std::string_view signature = GetRawTypeSignature<T>();
+        return signature.substr(prefixLength, signature.size() - prefixLength - suffixLength);
+    }
+
+    /*
+    * Reduces a container op's type name down to the name of its user-facing interface (e.g. "GetSize").
+    */
+    template <class TOp>
+    constexpr std::string_view GetOpName()
+    {
+        std::string_view name = GetTypeName<TOp>();
+        name = name.substr(0, name.find('<'));
+
+        if (const std::size_t scopeEnd = name.rfind("::"); scopeEnd != std::string_view::npos)
+        {
+            name.remove_prefix(scopeEnd + 2);
+        }
+
+        constexpr std::string_view opPrefix = "ContainerOp_";
+        if (name.starts_with(opPrefix))
+        {
+            name.remove_prefix(opPrefix.size());
+        }
+
+        return name;
+    }
+
+    inline std::vector<ContainerOpCounter>& GetMutableThreadCounters()
+    {
+        thread_local std::vector<ContainerOpCounter> counters;
+        return counters;
+    }
+
+    /*
+    * Each op and container type pair registers its counter once per thread, and caches the counter's index.
+    */
+    template <template<class> class ContainerOp_Generic, class T>
+    ContainerOpCounter& GetThreadCounter()
+    {
+        thread_local const std::size_t counterIndex = []
+            {
+                std::vector<ContainerOpCounter>& counters = GetMutableThreadCounters();
+                counters.push_back(ContainerOpCounter{ GetOpName<ContainerOp_Generic<T>>(), GetTypeName<std::remove_cvref_t<T>>() });
+                return counters.size() - 1;
+            }();
+
+        return GetMutableThreadCounters()[counterIndex];
+    }
+
+    /*
+    * Base of every interface while instrumenting. Interfaces inherit their op's ctrs, which default-initialize this
+    * base, so a call gets recorded for every interface constructed outside of constant evaluation.
+    */
+    template <template<class> class ContainerOp_Generic, class T>
+    struct ContainerOpCallRecorder
+    {
+        constexpr ContainerOpCallRecorder()
+        {
+            if (!std::is_constant_evaluated())
+            {
+                ++GetThreadCounter<ContainerOp_Generic, T>().CallCount;
+            }
+        }
+    };
+
+    /*
+    * Last capacity observed for a container, along with the container type it was observed as.
+    */
+    struct ObservedCapacity
+    {
+        std::string_view ContainerTypeName;
+        std::size_t Capacity = 0;
+    };
+
+    /*
+    * Observations are bounded, so long-running threads that observe many short-lived containers don't grow this forever.
+    */
+    inline constexpr std::size_t MaxObservedContainerCount = 4096;
+
+    inline std::unordered_map<const void*, ObservedCapacity>& GetMutableObservedCapacities()
+    {
+        thread_local std::unordered_map<const void*, ObservedCapacity> observedCapacities;
+        return observedCapacities;
+    }
+
+    /*
+    * Compares the capacity against the last one observed for this container, counting a change if they differ.
+    *
+    * Containers are identified by address and type, so a destroyed container whose address gets reused by one of the same
+    * type may count a change. Once the observation limit is reached, observations are forgotten, and the next observation
+    * of each container only records its capacity.
+    */
+    template <template<class> class ContainerOp_Generic, class T>
+    void RecordCapacityObservation(const void* container, const std::size_t capacity)
+    {
+        constexpr std::string_view containerTypeName = GetTypeName<std::remove_cvref_t<T>>();
+        std::unordered_map<const void*, ObservedCapacity>& observedCapacities = GetMutableObservedCapacities();
+
+        const auto it = observedCapacities.find(container);
+        if (it == observedCapacities.end() || it->second.ContainerTypeName != containerTypeName)
+        {
+            if (it == observedCapacities.end() && observedCapacities.size() >= MaxObservedContainerCount)
+            {
+                observedCapacities.clear();
+            }
+            observedCapacities.insert_or_assign(container, ObservedCapacity{ containerTypeName, capacity });
+        }
+        else if (it->second.Capacity != capacity)
+        {
+            it->second.Capacity = capacity;
+            ++GetThreadCounter<ContainerOp_Generic, T>().CapacityChangeCount;
+        }
+    }
+}
+
+namespace CppUtils::ContainerOps::Instrumentation
+{
+    /*
+    * Returns the counters recorded by the calling thread, in order of first use.
+    */
+    inline std::span<const ContainerOpCounter> GetThreadCounters()
+    {
+        return Detail::GetMutableThreadCounters();
+    }
+
+    /*
+    * Zeroes the calling thread's counts and forgets its observed capacities. Counters stay registered so that cached
+    * indices remain valid.
+    */
+    inline void ResetThreadCounters()
+    {
+        Detail::GetMutableObservedCapacities().clear();
+
+        for (ContainerOpCounter& counter : Detail::GetMutableThreadCounters())
+        {
+            counter.CallCount = 0;
+            counter.CapacityChangeCount = 0;
+        }
+    }
+
+    /*
+    * Writes the calling thread's counters to the stream, one line per op and container type pair.
+    */
+    inline void DumpThreadCounters(std::ostream& stream)
+    {
+        for (const ContainerOpCounter& counter : GetThreadCounters())
+        {
+            stream << counter.OpName << " [" << counter.ContainerTypeName << "] calls=" << counter.CallCount;
+            if (counter.CapacityChangeCount > 0)
+            {
+                stream << " capacityChanges=" << counter.CapacityChangeCount;
+            }
+            stream << '\n';
+        }
+    }
+}
+
+#endif // #if defined(CPPUTILS_CONTAINEROPS_INSTRUMENT)
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <CppUtils/Misc/TypeTraits.h>
 #include <CppUtils/Misc/FunctionTraits.h>
@@ -28,6 +31,16 @@ namespace CppUtils::ContainerOps::Detail
         );
     }
 
+    template <class TOp, class T>
+    consteval void AssertDoFunc_IsCtrContainerTypeParamNonConst()
+    {
+        static_assert
+        (
+            !std::is_constructible_v<TOp, TypeProbe_ConstRef<std::remove_cvref_t<T>>>,
+            "Container type for operation's ctr must be non-const, since the operation modifies the container."
+        );
+    }
+
     template <class TDoFuncTraits>
     consteval void AssertDoFunc_IsIntegralReturn()
     {
@@ -48,14 +61,22 @@ namespace CppUtils::ContainerOps::Detail
         );
     }
 
+    template <class TExpectedReturn, class TDoFuncTraits>
+    consteval void AssertDoFunc_IsReturnOfType()
+    {
+        static_assert
+        (
+            std::is_same_v<TExpectedReturn, typename TDoFuncTraits::ReturnType>,
+            "Operation's `Do` function must return the type required by its interface."
+        );
+    }
+
     /*
-    * Enforce proper returning of container element.
+    * Enforce proper returning of container element. The element type defaults to that of iterating the container.
     */
-    template <class TContainer, class TDoFuncTraits>
+    template <class TContainer, class TDoFuncTraits, class ElementType = ContainerElementType_t<std::remove_reference_t<TContainer>>>
     consteval void AssertDoFunc_IsContainerElementReturn()
     {
-        using ElementType = ContainerElementType_t<std::remove_reference_t<TContainer>>;
-
         // Enforce value type correctness between the container element type and the return type.
         {
             static_assert
@@ -70,20 +91,38 @@ namespace CppUtils::ContainerOps::Detail
         }
 
         // Enforce returning a reference to the container element. Caller may still grab a copy from this reference if needed.
-        static_assert
-        (
-            std::is_lvalue_reference_v<typename TDoFuncTraits::ReturnType>,
-            "Operation's `Do` function return type must be an lvalue reference."
-        );
+        // Containers whose elements are decoded on access (i.e. iterating yields values) have no element to refer to, so
+        // return copies instead. Copies can't modify the container, so constness doesn't apply to them.
+        constexpr bool bDecodesElementsOnAccess = requires (std::remove_reference_t<TContainer>& container)
+        {
+            requires !std::is_lvalue_reference_v<decltype(*std::begin(container))>;
+        };
 
-        // Enforce const correctness between the container and container element type with the return type.
+        if constexpr (bDecodesElementsOnAccess)
+        {
+            static_assert
+            (
+                !std::is_reference_v<typename TDoFuncTraits::ReturnType>,
+                "Operation's `Do` function must return by value, since the container's elements are decoded on access."
+            );
+        }
+        else
         {
             static_assert
             (
-                IsConstAfterRemovingRef<typename TDoFuncTraits::ReturnType>() == IsConstAfterRemovingRef<TContainer>(),
+                std::is_lvalue_reference_v<typename TDoFuncTraits::ReturnType>,
+                "Operation's `Do` function return type must be an lvalue reference."
+            );
+
+            // Enforce const correctness between the container and container element type with the return type.
+            // Containers of const elements (e.g. read-only snapshots) return const elements even through non-const access.
+            static_assert
+            (
+                IsConstAfterRemovingRef<typename TDoFuncTraits::ReturnType>() == IsConstAfterRemovingRef<TContainer>() ||
+                IsConstAfterRemovingRef<ElementType>(),
                 "Operation's `Do` function return type must be same constness as the container type."
             );
-    
+
             static_assert
             (
                 !IsConstAfterRemovingRef<ElementType>() ||
@@ -93,6 +132,45 @@ namespace CppUtils::ContainerOps::Detail
         }
     }
 
+    /*
+    * Enforce proper returning of a pointer to container elements.
+    */
+    template <class TContainer, class TDoFuncTraits>
+    consteval void AssertDoFunc_IsContainerElementPointerReturn()
+    {
+        using ElementType = ContainerElementType_t<std::remove_reference_t<TContainer>>;
+        using PointeeType = std::remove_pointer_t<typename TDoFuncTraits::ReturnType>;
+
+        static_assert
+        (
+            std::is_pointer_v<typename TDoFuncTraits::ReturnType>,
+            "Operation's `Do` function must return a pointer."
+        );
+
+        static_assert
+        (
+            std::is_same_v<std::remove_cv_t<PointeeType>, std::remove_cvref_t<ElementType>>,
+            "Operation's `Do` function must return a pointer to the container element's value type."
+        );
+
+        // Enforce const correctness between the container and container element type with the pointee type.
+        {
+            static_assert
+            (
+                std::is_const_v<PointeeType> == IsConstAfterRemovingRef<TContainer>() ||
+                IsConstAfterRemovingRef<ElementType>(),
+                "Operation's `Do` function must return a pointer of the same constness as the container type."
+            );
+
+            static_assert
+            (
+                !IsConstAfterRemovingRef<ElementType>() ||
+                std::is_const_v<PointeeType>,
+                "Operation's `Do` function must return a pointer that obeys the constness of the element type."
+            );
+        }
+    }
+
     template <class TDoFuncTraits>
     consteval void AssertDoFunc_HasNoParams()
     {
@@ -123,4 +201,21 @@ namespace CppUtils::ContainerOps::Detail
             "Operation's `Do` function must have integral type as its first parameter."
         );
     }
+
+    template <class T>
+    inline constexpr bool IsIndexArray = false;
+
+    template <class IndexType, std::size_t Rank>
+    inline constexpr bool IsIndexArray<std::array<IndexType, Rank>> = std::is_integral_v<IndexType>;
+
+    template <class TDoFuncTraits>
+    consteval void AssertDoFunc_HasIndexArrayFirstParam()
+    {
+        using FirstParam = std::remove_cvref_t<std::tuple_element_t<0, typename TDoFuncTraits::ArgsTuple>>;
+        static_assert
+        (
+            IsIndexArray<FirstParam>,
+            "Operation's `Do` function must have a `std::array` of integral indices (one per dimension) as its first parameter."
+        );
+    }
 }
@@ -2,12 +2,15 @@
 
 #pragma once
 
+#include <memory>
 #include <type_traits>
 #include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
 #include <CppUtils/Misc/Static_Execute.h>
 #include <CppUtils/Misc/Tag_IsPrimaryTemplate.h>
 #include <CppUtils_ContainerInterfaces/ContainerOpInterfaceDeductionGuides.h>
 #include <CppUtils_ContainerInterfaces/ContainerOpInterfaceStaticAsserts.h>
+#include <CppUtils_ContainerInterfaces/ContainerOpInstrumentation.h>
 
 /*
 * Base level interface for container ops. Container op interfaces must derive from this
@@ -19,6 +22,9 @@ namespace CppUtils::ContainerOps::Detail
         requires (!std::is_base_of_v<Tag_IsPrimaryTemplate, ContainerOp_Generic<T>>)
     struct ContainerOpInterfaceBase
         : ContainerOp_Generic<T>
+#if defined(CPPUTILS_CONTAINEROPS_INSTRUMENT)
+        , Instrumentation::Detail::ContainerOpCallRecorder<ContainerOp_Generic, T>
+#endif
     {
         using Op = ContainerOp_Generic<T>;
     protected: // Protected ctrs to keep this type abstract. Only non-base interfaces can be instantiated.
@@ -78,6 +84,36 @@ namespace CppUtils::ContainerOps::Detail
         CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsCtrContainerTypeParamConst<Op, T>());
         CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsIntegralReturn<DoFuncTraits>());
         CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasNoParams<DoFuncTraits>());
+
+#if defined(CPPUTILS_CONTAINEROPS_INSTRUMENT)
+        /*
+        * Stateful specializations report a capacity that can change at runtime. We remember which container is
+        * observed so that capacity changes between observations can be detected.
+        */
+        constexpr explicit ContainerOpInterface_GetCapacity(const std::remove_cvref_t<T>& container)
+            requires (!std::is_empty_v<Op>)
+            : InterfaceBase(container)
+            , m_ObservedContainer(std::addressof(container))
+        {
+        }
+
+        using InterfaceBase::Do;
+
+        constexpr auto Do() const
+            requires (!std::is_empty_v<Op>)
+        {
+            const auto capacity = InterfaceBase::Do();
+            if (!std::is_constant_evaluated())
+            {
+                Instrumentation::Detail::RecordCapacityObservation<ContainerOp_GetCapacity, T>(m_ObservedContainer, capacity);
+            }
+            return capacity;
+        }
+
+    private:
+
+        const void* m_ObservedContainer = nullptr;
+#endif
     };
 
     CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_GetCapacity, const)
@@ -179,4 +215,157 @@ namespace CppUtils::ContainerOps::Detail
     };
 
     CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_GetElement, )
+
+    template <class T>
+    struct ContainerOpInterface_GetMemoryUsage
+        : ContainerOpInterfaceBase<ContainerOp_GetMemoryUsage, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_GetMemoryUsage, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using Op = InterfaceBase::Op;
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsCtrContainerTypeParamConst<Op, T>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsReturnOfType<ContainerMemoryUsage, DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasNoParams<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_GetMemoryUsage, const)
+
+    template <class T>
+    struct ContainerOpInterface_ShrinkToFit
+        : ContainerOpInterfaceBase<ContainerOp_ShrinkToFit, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_ShrinkToFit, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using Op = InterfaceBase::Op;
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsCtrContainerTypeParamNonConst<Op, T>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsReturnOfType<void, DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasNoParams<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_ShrinkToFit, )
+
+    template <class T>
+    struct ContainerOpInterface_GetData
+        : ContainerOpInterfaceBase<ContainerOp_GetData, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_GetData, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsContainerElementPointerReturn<T, DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasNoParams<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_GetData, )
+
+    template <class T>
+    struct ContainerOpInterface_EraseAtUnordered
+        : ContainerOpInterfaceBase<ContainerOp_EraseAtUnordered, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_EraseAtUnordered, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using Op = InterfaceBase::Op;
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsCtrContainerTypeParamNonConst<Op, T>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsReturnOfType<void, DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasIntegralFirstParam<DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasExactlyOneParam<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_EraseAtUnordered, )
+
+    template <class T>
+    struct ContainerOpInterface_EraseAtOrdered
+        : ContainerOpInterfaceBase<ContainerOp_EraseAtOrdered, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_EraseAtOrdered, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using Op = InterfaceBase::Op;
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsCtrContainerTypeParamNonConst<Op, T>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsReturnOfType<void, DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasIntegralFirstParam<DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasExactlyOneParam<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_EraseAtOrdered, )
+
+    template <class T>
+    struct ContainerOpInterface_Truncate
+        : ContainerOpInterfaceBase<ContainerOp_Truncate, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_Truncate, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using Op = InterfaceBase::Op;
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsCtrContainerTypeParamNonConst<Op, T>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsReturnOfType<void, DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasIntegralFirstParam<DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasExactlyOneParam<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_Truncate, )
+
+    template <class T>
+    struct ContainerOpInterface_FindByHandle
+        : ContainerOpInterfaceBase<ContainerOp_FindByHandle, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_FindByHandle, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsContainerElementPointerReturn<T, DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasExactlyOneParam<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_FindByHandle, )
+
+    template <class T>
+    struct ContainerOpInterface_GetExtent
+        : ContainerOpInterfaceBase<ContainerOp_GetExtent, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_GetExtent, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using Op = InterfaceBase::Op;
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsCtrContainerTypeParamConst<Op, T>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsIntegralReturn<DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasIntegralFirstParam<DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasExactlyOneParam<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_GetExtent, const)
+
+    template <class T>
+    struct ContainerOpInterface_GetElementND
+        : ContainerOpInterfaceBase<ContainerOp_GetElementND, T>
+    {
+        using InterfaceBase = ContainerOpInterfaceBase<ContainerOp_GetElementND, T>;
+        using InterfaceBase::InterfaceBase;
+
+        using DoFuncTraits = InterfaceBase::DoFuncTraits;
+
+        // Multidimensional containers (e.g. `std::mdspan`) needn't be iterable, so their element type comes from `element_type`.
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_IsContainerElementReturn<T, DoFuncTraits, typename std::remove_cvref_t<T>::element_type>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasIndexArrayFirstParam<DoFuncTraits>());
+        CPPUTILS_STATIC_EXECUTE(AssertDoFunc_HasExactlyOneParam<DoFuncTraits>());
+    };
+
+    CPPUTILS_DECLARE_OP_INTERFACE_DEDUCTION_GUIDES(ContainerOpInterface_GetElementND, )
 }
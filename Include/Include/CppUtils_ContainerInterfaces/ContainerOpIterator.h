@@ -0,0 +1,78 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+
+namespace CppUtils::ContainerOps
+{
+    /*
+    * Random access iterator over any container that implements `GetElement`, by position.
+    *
+    * This lets standard and library algorithms that take iterators run on containers without contiguous storage
+    * (or without iterators of their own). For contiguous containers, prefer iterating the pointers from `GetData`.
+    */
+    template <class ContainerType>
+    class ContainerOpIterator
+    {
+    public:
+
+        using reference = decltype(GetElement{std::declval<ContainerType&>()}.Do(std::size_t{}));
+        using value_type = std::remove_cvref_t<reference>;
+        using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        constexpr ContainerOpIterator() = default;
+
+        constexpr ContainerOpIterator(ContainerType& container, const std::size_t index)
+            : m_Container(std::addressof(container))
+            , m_Index(static_cast<difference_type>(index))
+        {
+        }
+
+        constexpr reference operator*() const
+        {
+            return GetElement{*m_Container}.Do(static_cast<std::size_t>(m_Index));
+        }
+
+        constexpr pointer operator->() const
+        {
+            return std::addressof(**this);
+        }
+
+        constexpr reference operator[](const difference_type offset) const
+        {
+            return GetElement{*m_Container}.Do(static_cast<std::size_t>(m_Index + offset));
+        }
+
+        constexpr ContainerOpIterator& operator++() { ++m_Index; return *this; }
+        constexpr ContainerOpIterator& operator--() { --m_Index; return *this; }
+        constexpr ContainerOpIterator operator++(int) { ContainerOpIterator copy = *this; ++m_Index; return copy; }
+        constexpr ContainerOpIterator operator--(int) { ContainerOpIterator copy = *this; --m_Index; return copy; }
+
+        constexpr ContainerOpIterator& operator+=(const difference_type offset) { m_Index += offset; return *this; }
+        constexpr ContainerOpIterator& operator-=(const difference_type offset) { m_Index -= offset; return *this; }
+
+        constexpr ContainerOpIterator operator+(const difference_type offset) const { ContainerOpIterator copy = *this; return copy += offset; }
+        constexpr ContainerOpIterator operator-(const difference_type offset) const { ContainerOpIterator copy = *this; return copy -= offset; }
+        friend constexpr ContainerOpIterator operator+(const difference_type offset, const ContainerOpIterator& iterator) { return iterator + offset; }
+
+        constexpr difference_type operator-(const ContainerOpIterator& other) const { return m_Index - other.m_Index; }
+
+        constexpr bool operator==(const ContainerOpIterator& other) const { return m_Index == other.m_Index; }
+        constexpr std::strong_ordering operator<=>(const ContainerOpIterator& other) const { return m_Index <=> other.m_Index; }
+
+    private:
+
+        ContainerType* m_Container = nullptr;
+        difference_type m_Index = 0;
+    };
+}
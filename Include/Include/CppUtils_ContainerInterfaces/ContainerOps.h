@@ -39,4 +39,31 @@ namespace CppUtils::ContainerOps
 
     template <class ContainerType>
     using GetElement = Detail::ContainerOpInterface_GetElement<ContainerType>;
+
+    template <class ContainerType>
+    using GetMemoryUsage = Detail::ContainerOpInterface_GetMemoryUsage<ContainerType>;
+
+    template <class ContainerType>
+    using ShrinkToFit = Detail::ContainerOpInterface_ShrinkToFit<ContainerType>;
+
+    template <class ContainerType>
+    using GetData = Detail::ContainerOpInterface_GetData<ContainerType>;
+
+    template <class ContainerType>
+    using EraseAtUnordered = Detail::ContainerOpInterface_EraseAtUnordered<ContainerType>;
+
+    template <class ContainerType>
+    using EraseAtOrdered = Detail::ContainerOpInterface_EraseAtOrdered<ContainerType>;
+
+    template <class ContainerType>
+    using Truncate = Detail::ContainerOpInterface_Truncate<ContainerType>;
+
+    template <class ContainerType>
+    using FindByHandle = Detail::ContainerOpInterface_FindByHandle<ContainerType>;
+
+    template <class ContainerType>
+    using GetExtent = Detail::ContainerOpInterface_GetExtent<ContainerType>;
+
+    template <class ContainerType>
+    using GetElementND = Detail::ContainerOpInterface_GetElementND<ContainerType>;
 }
@@ -6,7 +6,7 @@
 #include <CppUtils/Misc/Tag_IsPrimaryTemplate.h>
 
 #define CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOpName) \
-    static_assert(sizeof(T) && false, "Provided container type has no implementation for " #ContainerOpName ". Either not supported by the container type, or the specialization simply wasn't implemented yet.");
+    static_assert(std::is_same_v<T, TypeProbe_ContainerOpSupport> || (sizeof(T) && false), "Provided container type has no implementation for " #ContainerOpName ". Either not supported by the container type, or the specialization simply wasn't implemented yet.");
 
 namespace CppUtils::ContainerOps::Detail
 {
@@ -16,6 +16,21 @@ namespace CppUtils::ContainerOps::Detail
     */
     template <class T>
     using SpecializationCompatibleT = std::remove_cvref_t<T>;
+
+    /*
+    * Stands in for the caller's container type when querying whether an op is implemented. The primary
+    * templates skip their static assert for this type, so that the query doesn't fail compilation.
+    */
+    struct TypeProbe_ContainerOpSupport
+    {
+    };
+
+    /*
+    * Whether the container type has a specialization for the container op. Generic code uses this to opt into
+    * ops that not every container supports.
+    */
+    template <template<class, class> class ContainerOp_Generic, class T>
+    concept IsContainerOpImplemented = !std::is_base_of_v<Tag_IsPrimaryTemplate, ContainerOp_Generic<TypeProbe_ContainerOpSupport, SpecializationCompatibleT<T>>>;
 }
 
 /*
@@ -89,6 +104,91 @@ namespace CppUtils::ContainerOps::Detail
         CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_GetElement);
     };
 
+    /*
+    * Returns the container's memory footprint in bytes (see `ContainerMemoryUsage`). Elements' own allocations aren't included.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_GetMemoryUsage : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_GetMemoryUsage);
+    };
+
+    /*
+    * Releases storage beyond the container's size. A no-op for containers without dynamic storage.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_ShrinkToFit : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_ShrinkToFit);
+    };
+
+    /*
+    * Returns a pointer to the first element of the container's contiguous storage. Only implemented by containers
+    * whose elements are stored contiguously, so generic code can detect it to take bulk memory fast paths.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_GetData : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_GetData);
+    };
+
+    /*
+    * Removes the element at index by moving the last element into its place. Constant time, but doesn't preserve
+    * the order of the remaining elements. No bounds checking.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_EraseAtUnordered : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_EraseAtUnordered);
+    };
+
+    /*
+    * Removes the element at index, shifting the elements after it down by one. No bounds checking.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_EraseAtOrdered : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_EraseAtOrdered);
+    };
+
+    /*
+    * Removes elements from the back until the container has at most the provided size. Never grows the container.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_Truncate : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_Truncate);
+    };
+
+    /*
+    * Returns a pointer to the element referred to by the handle, or null if the handle no longer refers to an element.
+    * Only implemented by containers with stable handles (e.g. `SlotMap`), which define the handle type.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_FindByHandle : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_FindByHandle);
+    };
+
+    /*
+    * Returns the number of elements along the dimension of a multidimensional container.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_GetExtent : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_GetExtent);
+    };
+
+    /*
+    * Returns the element of a multidimensional container at the multi-index (a `std::array` with one index per dimension).
+    * Where the element lives in memory is up to the container's layout.
+    */
+    template <class T, class SpecializationKey = SpecializationCompatibleT<T>>
+    struct ContainerOp_GetElementND : Tag_IsPrimaryTemplate
+    {
+        CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT(ContainerOp_GetElementND);
+    };
+
 }
 
 #if !defined(CONTAINER_OP_PRIMARY_TEMPLATE_STATIC_ASSERT)
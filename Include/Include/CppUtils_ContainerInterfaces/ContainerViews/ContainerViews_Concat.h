@@ -0,0 +1,145 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Iterator.h>
+
+namespace CppUtils::ContainerViews
+{
+    /*
+    * Several containers (segments), possibly of different types, presented as one. E.g. a fixed size header array followed
+    * by a vector body, without copying them into one buffer.
+    *
+    * The view keeps the running totals of the segment sizes, so positional access binary searches for the segment, O(log k)
+    * for k segments. For bulk work, `ForEachSegment` visits each segment as its own container type, so per segment fast
+    * paths (e.g. contiguous `GetData` in the container algorithms) still apply.
+    *
+    * The view refers to the containers, which must outlive it. Segment sizes are recorded on construction, so call `Refresh`
+    * after resizing any segment. Accessing through a const view gives const elements.
+    */
+    template <class... ContainerTypes>
+    class ConcatView
+    {
+        static_assert(sizeof...(ContainerTypes) > 0, "Concatenation needs at least one container.");
+
+        template <class ContainerType>
+        using UnderlyingReference = decltype(ContainerOps::GetElement{std::declval<ContainerType&>()}.Do(std::size_t{}));
+
+    public:
+
+        using value_type = std::remove_cvref_t<UnderlyingReference<std::tuple_element_t<0, std::tuple<ContainerTypes...>>>>;
+
+        static_assert
+        (
+            (std::is_same_v<std::remove_cvref_t<UnderlyingReference<ContainerTypes>>, value_type> && ...),
+            "Concatenated containers must have the same element value type."
+        );
+
+        // Const if any segment's elements are.
+        using element_type = std::conditional_t<(std::is_const_v<std::remove_reference_t<UnderlyingReference<ContainerTypes>>> || ...), const value_type, value_type>;
+
+        static constexpr std::size_t SegmentCount = sizeof...(ContainerTypes);
+
+        constexpr explicit ConcatView(ContainerTypes&... containers)
+            : m_Containers(std::addressof(containers)...)
+        {
+            Refresh();
+        }
+
+        /*
+        * Records the current sizes of the segments.
+        */
+        constexpr void Refresh()
+        {
+            [this]<std::size_t... SegmentIndices>(std::index_sequence<SegmentIndices...>)
+            {
+                std::size_t segmentEnd = 0;
+                ((m_SegmentEnds[SegmentIndices] = segmentEnd += ContainerOps::GetSize{*std::get<SegmentIndices>(m_Containers)}.Do()), ...);
+            }(std::index_sequence_for<ContainerTypes...>{});
+        }
+
+        constexpr std::size_t GetSize() const { return m_SegmentEnds.back(); }
+        constexpr bool IsEmpty() const { return GetSize() == 0; }
+
+        /*
+        * Position of the segment's first element in the view.
+        */
+        constexpr std::size_t GetSegmentOffset(const std::size_t segment) const
+        {
+            return segment == 0 ? 0 : m_SegmentEnds[segment - 1];
+        }
+
+        /*
+        * Segment holding the view's element at the index.
+        */
+        constexpr std::size_t GetSegment(const std::size_t index) const
+        {
+            return static_cast<std::size_t>(std::upper_bound(m_SegmentEnds.begin(), m_SegmentEnds.end(), index) - m_SegmentEnds.begin());
+        }
+
+        constexpr element_type& operator[](const std::size_t index)
+        {
+            return GetElementInSegment(GetSegment(index), index);
+        }
+
+        constexpr const element_type& operator[](const std::size_t index) const
+        {
+            return GetElementInSegment(GetSegment(index), index);
+        }
+
+        /*
+        * Calls the function with each segment's container, in order.
+        */
+        template <class FunctionType>
+        constexpr void ForEachSegment(FunctionType&& function)
+        {
+            std::apply([&function](ContainerTypes*... containers) { (function(*containers), ...); }, m_Containers);
+        }
+
+        template <class FunctionType>
+        constexpr void ForEachSegment(FunctionType&& function) const
+        {
+            std::apply([&function](ContainerTypes*... containers) { (function(std::as_const(*containers)), ...); }, m_Containers);
+        }
+
+        constexpr Detail::ViewIterator<ConcatView> begin() { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<ConcatView> end() { return { *this, GetSize() }; }
+        constexpr Detail::ViewIterator<const ConcatView> begin() const { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<const ConcatView> end() const { return { *this, GetSize() }; }
+
+    private:
+
+        template <std::size_t Segment>
+        static constexpr element_type& GetElementInSegmentAt(const ConcatView& view, const std::size_t index)
+        {
+            return ContainerOps::GetElement{*std::get<Segment>(view.m_Containers)}.Do(index - view.GetSegmentOffset(Segment));
+        }
+
+        /*
+        * Dispatches to the segment's container type through a table, so access costs the same for every segment.
+        */
+        constexpr element_type& GetElementInSegment(const std::size_t segment, const std::size_t index) const
+        {
+            using SegmentAccessor = element_type& (*)(const ConcatView&, std::size_t);
+            constexpr std::array<SegmentAccessor, SegmentCount> segmentAccessors = []<std::size_t... SegmentIndices>(std::index_sequence<SegmentIndices...>)
+            {
+                return std::array<SegmentAccessor, SegmentCount>{ &GetElementInSegmentAt<SegmentIndices>... };
+            }(std::index_sequence_for<ContainerTypes...>{});
+
+            return segmentAccessors[segment](*this, index);
+        }
+
+        std::tuple<ContainerTypes*...> m_Containers;
+
+        // Running totals of the segment sizes, i.e. the end position of each segment in the view.
+        std::array<std::size_t, SegmentCount> m_SegmentEnds {};
+    };
+}
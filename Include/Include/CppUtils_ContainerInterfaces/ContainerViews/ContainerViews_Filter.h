@@ -0,0 +1,169 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+
+namespace CppUtils::ContainerViews
+{
+    /*
+    * The elements of a container that match a predicate, in order.
+    *
+    * Without a cached index, positional access (`GetSize`, `GetElement`, etc.) scans the container from the start, so it's
+    * O(n) per access. Iterating the view is a single scan. For repeated positional access, `CacheIndex` records the matching
+    * positions once, making positional access O(1). The cached index isn't updated when the container changes, so recache
+    * (or `ClearIndex`) after modifying it.
+    *
+    * The view refers to the container, which must outlive it. Accessing through a const view gives const elements.
+    */
+    template <class ContainerType, class PredicateType>
+    class FilterView
+    {
+        using UnderlyingReference = decltype(ContainerOps::GetElement{std::declval<ContainerType&>()}.Do(std::size_t{}));
+
+        /*
+        * Forward iterator skipping over non-matching elements. `ViewType` is const for const iteration.
+        */
+        template <class ViewType>
+        class Iterator
+        {
+        public:
+
+            using reference = decltype(std::declval<ViewType&>()[std::size_t{}]);
+            using value_type = std::remove_cvref_t<reference>;
+            using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+
+            constexpr Iterator() = default;
+
+            /*
+            * Starts at the first match at or after the container position.
+            */
+            constexpr Iterator(ViewType& view, const std::size_t containerIndex)
+                : m_View(std::addressof(view))
+                , m_ContainerIndex(view.FindMatch(containerIndex))
+            {
+            }
+
+            constexpr reference operator*() const { return ContainerOps::GetElement{*m_View->m_Container}.Do(m_ContainerIndex); }
+            constexpr pointer operator->() const { return std::addressof(**this); }
+
+            constexpr Iterator& operator++() { m_ContainerIndex = m_View->FindMatch(m_ContainerIndex + 1); return *this; }
+            constexpr Iterator operator++(int) { Iterator copy = *this; ++*this; return copy; }
+
+            constexpr bool operator==(const Iterator& other) const { return m_ContainerIndex == other.m_ContainerIndex; }
+
+        private:
+
+            ViewType* m_View = nullptr;
+            std::size_t m_ContainerIndex = 0;
+        };
+
+    public:
+
+        using element_type = std::remove_reference_t<UnderlyingReference>;
+        using value_type = std::remove_cv_t<element_type>;
+
+        constexpr FilterView(ContainerType& container, PredicateType predicate)
+            : m_Container(std::addressof(container))
+            , m_Predicate(std::move(predicate))
+        {
+        }
+
+        /*
+        * Records the positions of the matching elements, for O(1) positional access.
+        */
+        constexpr void CacheIndex()
+        {
+            std::vector<std::size_t> index;
+            const std::size_t containerSize = ContainerOps::GetSize{*m_Container}.Do();
+            for (std::size_t containerIndex = FindMatch(0); containerIndex < containerSize; containerIndex = FindMatch(containerIndex + 1))
+            {
+                index.push_back(containerIndex);
+            }
+            m_Index = std::move(index);
+        }
+
+        constexpr void ClearIndex() { m_Index.reset(); }
+        constexpr bool IsIndexCached() const { return m_Index.has_value(); }
+
+        constexpr std::size_t GetSize() const
+        {
+            if (m_Index)
+            {
+                return m_Index->size();
+            }
+
+            std::size_t size = 0;
+            const std::size_t containerSize = ContainerOps::GetSize{*m_Container}.Do();
+            for (std::size_t containerIndex = FindMatch(0); containerIndex < containerSize; containerIndex = FindMatch(containerIndex + 1))
+            {
+                ++size;
+            }
+            return size;
+        }
+
+        constexpr bool IsEmpty() const { return FindMatch(0) == ContainerOps::GetSize{*m_Container}.Do(); }
+
+        /*
+        * Position in the container of the view's element at the index.
+        */
+        constexpr std::size_t GetContainerIndex(const std::size_t index) const
+        {
+            if (m_Index)
+            {
+                return (*m_Index)[index];
+            }
+
+            std::size_t containerIndex = FindMatch(0);
+            for (std::size_t i = 0; i < index; ++i)
+            {
+                containerIndex = FindMatch(containerIndex + 1);
+            }
+            return containerIndex;
+        }
+
+        constexpr element_type& operator[](const std::size_t index)
+        {
+            return ContainerOps::GetElement{*m_Container}.Do(GetContainerIndex(index));
+        }
+
+        constexpr const element_type& operator[](const std::size_t index) const
+        {
+            return ContainerOps::GetElement{*m_Container}.Do(GetContainerIndex(index));
+        }
+
+        constexpr Iterator<FilterView> begin() { return { *this, 0 }; }
+        constexpr Iterator<FilterView> end() { return { *this, ContainerOps::GetSize{*m_Container}.Do() }; }
+        constexpr Iterator<const FilterView> begin() const { return { *this, 0 }; }
+        constexpr Iterator<const FilterView> end() const { return { *this, ContainerOps::GetSize{*m_Container}.Do() }; }
+
+    private:
+
+        /*
+        * Position of the first matching element at or after the container position, or the container's size if none.
+        */
+        constexpr std::size_t FindMatch(std::size_t containerIndex) const
+        {
+            const std::size_t containerSize = ContainerOps::GetSize{*m_Container}.Do();
+            while (containerIndex < containerSize && !m_Predicate(std::as_const(ContainerOps::GetElement{*m_Container}.Do(containerIndex))))
+            {
+                ++containerIndex;
+            }
+            return containerIndex;
+        }
+
+        ContainerType* m_Container;
+        PredicateType m_Predicate;
+        std::optional<std::vector<std::size_t>> m_Index;
+    };
+}
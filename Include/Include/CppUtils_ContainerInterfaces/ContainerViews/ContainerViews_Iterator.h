@@ -0,0 +1,66 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace CppUtils::ContainerViews::Detail
+{
+    /*
+    * Random access iterator over a view, by position through the view's `operator[]`. `ViewType` is const for const
+    * iteration.
+    *
+    * Views iterate through their own subscript rather than the `GetElement` op, since the op's checks derive the element
+    * type from the iterator.
+    */
+    template <class ViewType>
+    class ViewIterator
+    {
+    public:
+
+        using reference = decltype(std::declval<ViewType&>()[std::size_t{}]);
+        using value_type = std::remove_cvref_t<reference>;
+        using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        constexpr ViewIterator() = default;
+
+        constexpr ViewIterator(ViewType& view, const std::size_t index)
+            : m_View(std::addressof(view))
+            , m_Index(static_cast<difference_type>(index))
+        {
+        }
+
+        constexpr reference operator*() const { return (*m_View)[static_cast<std::size_t>(m_Index)]; }
+        constexpr pointer operator->() const { return std::addressof(**this); }
+        constexpr reference operator[](const difference_type offset) const { return (*m_View)[static_cast<std::size_t>(m_Index + offset)]; }
+
+        constexpr ViewIterator& operator++() { ++m_Index; return *this; }
+        constexpr ViewIterator& operator--() { --m_Index; return *this; }
+        constexpr ViewIterator operator++(int) { ViewIterator copy = *this; ++m_Index; return copy; }
+        constexpr ViewIterator operator--(int) { ViewIterator copy = *this; --m_Index; return copy; }
+
+        constexpr ViewIterator& operator+=(const difference_type offset) { m_Index += offset; return *this; }
+        constexpr ViewIterator& operator-=(const difference_type offset) { m_Index -= offset; return *this; }
+
+        constexpr ViewIterator operator+(const difference_type offset) const { ViewIterator copy = *this; return copy += offset; }
+        constexpr ViewIterator operator-(const difference_type offset) const { ViewIterator copy = *this; return copy -= offset; }
+        friend constexpr ViewIterator operator+(const difference_type offset, const ViewIterator& iterator) { return iterator + offset; }
+
+        constexpr difference_type operator-(const ViewIterator& other) const { return m_Index - other.m_Index; }
+
+        constexpr bool operator==(const ViewIterator& other) const { return m_Index == other.m_Index; }
+        constexpr std::strong_ordering operator<=>(const ViewIterator& other) const { return m_Index <=> other.m_Index; }
+
+    private:
+
+        ViewType* m_View = nullptr;
+        difference_type m_Index = 0;
+    };
+}
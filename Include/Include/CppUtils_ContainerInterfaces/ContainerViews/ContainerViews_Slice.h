@@ -0,0 +1,80 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Iterator.h>
+
+namespace CppUtils::ContainerViews
+{
+    /*
+    * A contiguous range of a container's elements. Also contiguous in memory (`GetData`) if the container is.
+    *
+    * The view refers to the container, which must outlive it and keep at least `offset + count` elements.
+    */
+    template <class ContainerType>
+    class SliceView
+    {
+        using UnderlyingReference = decltype(ContainerOps::GetElement{std::declval<ContainerType&>()}.Do(std::size_t{}));
+
+    public:
+
+        using element_type = std::remove_reference_t<UnderlyingReference>;
+        using value_type = std::remove_cv_t<element_type>;
+
+        constexpr SliceView(ContainerType& container, const std::size_t offset, const std::size_t count)
+            : m_Container(std::addressof(container))
+            , m_Offset(offset)
+            , m_Count(count)
+        {
+            assert(offset + count <= ContainerOps::GetSize{container}.Do() && "Slice must be within the container.");
+        }
+
+        constexpr std::size_t GetSize() const { return m_Count; }
+        constexpr bool IsEmpty() const { return m_Count == 0; }
+
+        /*
+        * Offset of the slice's first element in the container.
+        */
+        constexpr std::size_t GetOffset() const { return m_Offset; }
+
+        constexpr element_type& operator[](const std::size_t index)
+        {
+            return ContainerOps::GetElement{*m_Container}.Do(m_Offset + index);
+        }
+
+        constexpr const element_type& operator[](const std::size_t index) const
+        {
+            return ContainerOps::GetElement{*m_Container}.Do(m_Offset + index);
+        }
+
+        /*
+        * Only for containers implementing `GetData`.
+        */
+        constexpr element_type* GetData()
+        {
+            return ContainerOps::GetData{*m_Container}.Do() + m_Offset;
+        }
+
+        constexpr const element_type* GetData() const
+        {
+            return ContainerOps::GetData{*m_Container}.Do() + m_Offset;
+        }
+
+        constexpr Detail::ViewIterator<SliceView> begin() { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<SliceView> end() { return { *this, m_Count }; }
+        constexpr Detail::ViewIterator<const SliceView> begin() const { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<const SliceView> end() const { return { *this, m_Count }; }
+
+    private:
+
+        ContainerType* m_Container;
+        std::size_t m_Offset;
+        std::size_t m_Count;
+    };
+}
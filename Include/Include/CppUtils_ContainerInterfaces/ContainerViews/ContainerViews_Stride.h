@@ -0,0 +1,67 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Iterator.h>
+
+namespace CppUtils::ContainerViews
+{
+    /*
+    * Every `stride`th element of a container, starting at `offset`. E.g. one channel of interleaved samples. A stride of
+    * zero is treated as one.
+    *
+    * The view refers to the container, which must outlive it. Its size follows the container's.
+    */
+    template <class ContainerType>
+    class StrideView
+    {
+        using UnderlyingReference = decltype(ContainerOps::GetElement{std::declval<ContainerType&>()}.Do(std::size_t{}));
+
+    public:
+
+        using element_type = std::remove_reference_t<UnderlyingReference>;
+        using value_type = std::remove_cv_t<element_type>;
+
+        constexpr StrideView(ContainerType& container, const std::size_t stride, const std::size_t offset = 0)
+            : m_Container(std::addressof(container))
+            , m_Stride(std::max<std::size_t>(stride, 1))
+            , m_Offset(offset)
+        {
+        }
+
+        constexpr std::size_t GetSize() const
+        {
+            const std::size_t containerSize = ContainerOps::GetSize{*m_Container}.Do();
+            return containerSize > m_Offset ? (containerSize - m_Offset + m_Stride - 1) / m_Stride : 0;
+        }
+
+        constexpr bool IsEmpty() const { return GetSize() == 0; }
+
+        constexpr element_type& operator[](const std::size_t index)
+        {
+            return ContainerOps::GetElement{*m_Container}.Do(m_Offset + index * m_Stride);
+        }
+
+        constexpr const element_type& operator[](const std::size_t index) const
+        {
+            return ContainerOps::GetElement{*m_Container}.Do(m_Offset + index * m_Stride);
+        }
+
+        constexpr Detail::ViewIterator<StrideView> begin() { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<StrideView> end() { return { *this, GetSize() }; }
+        constexpr Detail::ViewIterator<const StrideView> begin() const { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<const StrideView> end() const { return { *this, GetSize() }; }
+
+    private:
+
+        ContainerType* m_Container;
+        std::size_t m_Stride;
+        std::size_t m_Offset;
+    };
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Iterator.h>
+
+namespace CppUtils::ContainerViews
+{
+    /*
+    * Lazily projects each element of a container, e.g. to one of its members.
+    *
+    * The projection is applied on every access, to the element that `GetElement` returns. It must return an lvalue
+    * reference (into the element, or elsewhere that outlives the access), since the view's `GetElement` returns a reference
+    * like every other container's. Computing new values per element would need them materialized somewhere, which is what
+    * views avoid.
+    *
+    * The view refers to the container, which must outlive it. Accessing through a const view gives const elements.
+    */
+    template <class ContainerType, class ProjectionType>
+    class TransformView
+    {
+        using UnderlyingReference = decltype(ContainerOps::GetElement{std::declval<ContainerType&>()}.Do(std::size_t{}));
+        using ProjectionResult = std::invoke_result_t<const ProjectionType&, UnderlyingReference>;
+
+        static_assert(std::is_lvalue_reference_v<ProjectionResult>, "Projection must return an lvalue reference.");
+
+    public:
+
+        using element_type = std::remove_reference_t<ProjectionResult>;
+        using value_type = std::remove_cv_t<element_type>;
+
+        constexpr TransformView(ContainerType& container, ProjectionType projection)
+            : m_Container(std::addressof(container))
+            , m_Projection(std::move(projection))
+        {
+        }
+
+        constexpr std::size_t GetSize() const { return ContainerOps::GetSize{*m_Container}.Do(); }
+        constexpr bool IsEmpty() const { return GetSize() == 0; }
+
+        constexpr element_type& operator[](const std::size_t index)
+        {
+            return std::invoke(std::as_const(m_Projection), ContainerOps::GetElement{*m_Container}.Do(index));
+        }
+
+        constexpr const element_type& operator[](const std::size_t index) const
+        {
+            return std::invoke(m_Projection, ContainerOps::GetElement{*m_Container}.Do(index));
+        }
+
+        constexpr Detail::ViewIterator<TransformView> begin() { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<TransformView> end() { return { *this, GetSize() }; }
+        constexpr Detail::ViewIterator<const TransformView> begin() const { return { *this, 0 }; }
+        constexpr Detail::ViewIterator<const TransformView> end() const { return { *this, GetSize() }; }
+
+    private:
+
+        ContainerType* m_Container;
+        ProjectionType m_Projection;
+    };
+}
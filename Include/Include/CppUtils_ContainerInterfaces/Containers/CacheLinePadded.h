@@ -0,0 +1,95 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+namespace CppUtils::Containers
+{
+    /*
+    * Minimum distance between two objects to avoid false sharing.
+    */
+#if defined(__cpp_lib_hardware_interference_size)
+#   if defined(__GNUC__) && !defined(__clang__)
+        // GCC warns that the value may differ between translation units built with different tuning flags. We only use it for
+        // padding, which stays correct (if not optimal) in that case.
+#       pragma GCC diagnostic push
+#       pragma GCC diagnostic ignored "-Winterference-size"
+#   endif
+    inline constexpr std::size_t CacheLineSize = std::hardware_destructive_interference_size;
+#   if defined(__GNUC__) && !defined(__clang__)
+#       pragma GCC diagnostic pop
+#   endif
+#else
+    inline constexpr std::size_t CacheLineSize = 64;
+#endif
+
+    /*
+    * Holds the value alone on its own cache line(s), so that writes to neighboring objects don't invalidate it.
+    */
+    template <class T>
+    struct alignas(CacheLineSize) CacheLinePadded
+    {
+        T Value {};
+    };
+
+    /*
+    * Random access iterator over the values of contiguous `CacheLinePadded` objects. `T` is const for const iteration.
+    */
+    template <class T>
+    class CacheLinePaddedIterator
+    {
+    public:
+
+        using value_type = std::remove_const_t<T>;
+        using reference = T&;
+        using pointer = T*;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        using PaddedType = std::conditional_t<std::is_const_v<T>, const CacheLinePadded<value_type>, CacheLinePadded<value_type>>;
+
+        constexpr CacheLinePaddedIterator() = default;
+
+        constexpr explicit CacheLinePaddedIterator(PaddedType* const padded)
+            : m_Padded(padded)
+        {
+        }
+
+        constexpr operator CacheLinePaddedIterator<const T>() const
+            requires (!std::is_const_v<T>)
+        {
+            return CacheLinePaddedIterator<const T>(m_Padded);
+        }
+
+        constexpr reference operator*() const { return m_Padded->Value; }
+        constexpr pointer operator->() const { return &m_Padded->Value; }
+        constexpr reference operator[](const difference_type offset) const { return m_Padded[offset].Value; }
+
+        constexpr CacheLinePaddedIterator& operator++() { ++m_Padded; return *this; }
+        constexpr CacheLinePaddedIterator& operator--() { --m_Padded; return *this; }
+        constexpr CacheLinePaddedIterator operator++(int) { CacheLinePaddedIterator copy = *this; ++m_Padded; return copy; }
+        constexpr CacheLinePaddedIterator operator--(int) { CacheLinePaddedIterator copy = *this; --m_Padded; return copy; }
+
+        constexpr CacheLinePaddedIterator& operator+=(const difference_type offset) { m_Padded += offset; return *this; }
+        constexpr CacheLinePaddedIterator& operator-=(const difference_type offset) { m_Padded -= offset; return *this; }
+
+        constexpr CacheLinePaddedIterator operator+(const difference_type offset) const { CacheLinePaddedIterator copy = *this; return copy += offset; }
+        constexpr CacheLinePaddedIterator operator-(const difference_type offset) const { CacheLinePaddedIterator copy = *this; return copy -= offset; }
+        friend constexpr CacheLinePaddedIterator operator+(const difference_type offset, const CacheLinePaddedIterator& iterator) { return iterator + offset; }
+
+        constexpr difference_type operator-(const CacheLinePaddedIterator& other) const { return m_Padded - other.m_Padded; }
+
+        constexpr bool operator==(const CacheLinePaddedIterator& other) const { return m_Padded == other.m_Padded; }
+        constexpr std::strong_ordering operator<=>(const CacheLinePaddedIterator& other) const { return m_Padded <=> other.m_Padded; }
+
+    private:
+
+        PaddedType* m_Padded = nullptr;
+    };
+}
@@ -0,0 +1,342 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/CacheLinePadded.h>
+
+namespace CppUtils::Containers
+{
+    /*
+    * Priority queue on a heap where each node has `Arity` children. Like `std::priority_queue`, the top is the greatest
+    * element by the comparison (so `std::greater` gives a min-queue).
+    *
+    * A wider heap is shallower, so sifting takes fewer steps, and each step compares all of a node's children, which are
+    * adjacent. Storage is cache line aligned and offset so that every group of siblings starts at a multiple of `Arity`
+    * elements, so a group never straddles cache lines when `Arity * sizeof(T)` divides the cache line size (e.g. 8-ary of
+    * 8-byte elements). Each sift step then touches a single cache line.
+    *
+    * Elements are only readable, in heap order, since modifying them could break the heap.
+    */
+    template <class T, std::size_t Arity = 4, class CompareType = std::less<T>>
+    class DaryHeap
+    {
+        static_assert(Arity >= 2, "Heap nodes must have at least two children.");
+
+    public:
+
+        using value_type = T;
+
+        DaryHeap() = default;
+
+        explicit DaryHeap(const CompareType& compare)
+            : m_Compare(compare)
+        {
+        }
+
+        // Delegates so that the heap is constructed before copying, and its dtor frees the allocation if a copy throws.
+        DaryHeap(const DaryHeap& other)
+            : DaryHeap(other.m_Compare)
+        {
+            Reserve(other.m_Size);
+            std::uninitialized_copy_n(other.m_Elements, other.m_Size, m_Elements);
+            m_Size = other.m_Size;
+        }
+
+        DaryHeap(DaryHeap&& other) noexcept
+            : m_Allocation(std::exchange(other.m_Allocation, nullptr))
+            , m_Elements(std::exchange(other.m_Elements, nullptr))
+            , m_Size(std::exchange(other.m_Size, 0))
+            , m_Capacity(std::exchange(other.m_Capacity, 0))
+            , m_Compare(other.m_Compare)
+        {
+        }
+
+        DaryHeap& operator=(DaryHeap other) noexcept
+        {
+            std::swap(m_Allocation, other.m_Allocation);
+            std::swap(m_Elements, other.m_Elements);
+            std::swap(m_Size, other.m_Size);
+            std::swap(m_Capacity, other.m_Capacity);
+            std::swap(m_Compare, other.m_Compare);
+            return *this;
+        }
+
+        ~DaryHeap()
+        {
+            Clear();
+            Free();
+        }
+
+        template <class... ArgTypes>
+        void Emplace(ArgTypes&&... args)
+        {
+            EmplaceBack(std::forward<ArgTypes>(args)...);
+            SiftUp(m_Size - 1);
+        }
+
+        void Push(const T& value) { Emplace(value); }
+        void Push(T&& value) { Emplace(std::move(value)); }
+
+        /*
+        * Pushes all of the elements. Rebuilds the heap in linear time when pushing at least as many as there were, which
+        * beats sifting each one up.
+        */
+        template <class IteratorType>
+        void PushMany(IteratorType first, const IteratorType last)
+        {
+            const std::size_t oldSize = m_Size;
+            if constexpr (std::forward_iterator<IteratorType>)
+            {
+                const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+                if (m_Size + count > m_Capacity)
+                {
+                    // The range may be of this heap's elements, which growing frees. So it's copied into the new storage
+                    // first, the elements are moved after it, and the heap is rebuilt (in linear time, like the growth).
+                    DaryHeap grown(m_Compare);
+                    grown.Reserve(m_Size + count);
+                    for (; first != last; ++first)
+                    {
+                        grown.EmplaceBack(*first);
+                    }
+                    for (std::size_t i = 0; i < m_Size; ++i)
+                    {
+                        grown.EmplaceBack(std::move_if_noexcept(m_Elements[i]));
+                    }
+                    grown.Heapify();
+                    *this = std::move(grown);
+                    return;
+                }
+            }
+            for (; first != last; ++first)
+            {
+                EmplaceBack(*first);
+            }
+
+            if (m_Size - oldSize >= oldSize)
+            {
+                Heapify();
+            }
+            else
+            {
+                for (std::size_t i = oldSize; i < m_Size; ++i)
+                {
+                    SiftUp(i);
+                }
+            }
+        }
+
+        const T& GetTop() const { return m_Elements[0]; }
+
+        void Pop()
+        {
+            --m_Size;
+            if (m_Size > 0)
+            {
+                m_Elements[0] = std::move(m_Elements[m_Size]);
+                std::destroy_at(m_Elements + m_Size);
+                SiftDown(0);
+            }
+            else
+            {
+                std::destroy_at(m_Elements);
+            }
+        }
+
+        /*
+        * Removes and returns the top element.
+        */
+        T PopTop()
+        {
+            T top = std::move(m_Elements[0]);
+            Pop();
+            return top;
+        }
+
+        /*
+        * Moves up to `count` top elements to the output, greatest first, and removes them. Returns the end of the output.
+        */
+        template <class OutputIteratorType>
+        OutputIteratorType PopMany(std::size_t count, OutputIteratorType output)
+        {
+            for (count = std::min(count, m_Size); count > 0; --count)
+            {
+                *output = std::move(m_Elements[0]);
+                ++output;
+                Pop();
+            }
+            return output;
+        }
+
+        void Reserve(const std::size_t capacity)
+        {
+            if (capacity <= m_Capacity)
+            {
+                return;
+            }
+
+            // Built in a separate heap, whose dtor frees the new storage if an element's copy throws. Like `std::vector`,
+            // elements are only moved if that can't throw, so a failure leaves this heap unchanged.
+            DaryHeap grown(m_Compare);
+            grown.m_Allocation = static_cast<std::byte*>(::operator new(GetAllocationSize(capacity), GetAllocationAlignment()));
+            grown.m_Elements = reinterpret_cast<T*>(grown.m_Allocation) + (Arity - 1);
+            grown.m_Capacity = capacity;
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            {
+                std::uninitialized_move_n(m_Elements, m_Size, grown.m_Elements);
+            }
+            else
+            {
+                std::uninitialized_copy_n(m_Elements, m_Size, grown.m_Elements);
+            }
+            grown.m_Size = m_Size;
+
+            *this = std::move(grown);
+        }
+
+        void Clear()
+        {
+            std::destroy_n(m_Elements, m_Size);
+            m_Size = 0;
+        }
+
+        std::size_t GetSize() const { return m_Size; }
+        std::size_t GetCapacity() const { return m_Capacity; }
+        bool IsEmpty() const { return m_Size == 0; }
+
+        /*
+        * Elements in heap order.
+        */
+        const T* begin() const { return m_Elements; }
+        const T* end() const { return m_Elements + m_Size; }
+
+        ContainerOps::ContainerMemoryUsage GetMemoryUsage() const
+        {
+            const std::size_t allocationSize = m_Allocation != nullptr ? GetAllocationSize(m_Capacity) : 0;
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = allocationSize,
+                .InlineBytes = sizeof(*this),
+                .SlackBytes = allocationSize - m_Size * sizeof(T),
+            };
+        }
+
+    private:
+
+        /*
+        * Constructs an element after the last one, without restoring heap order.
+        */
+        template <class... ArgTypes>
+        void EmplaceBack(ArgTypes&&... args)
+        {
+            if (m_Size == m_Capacity)
+            {
+                // The arguments may refer to an element (e.g. pushing `GetTop()`), which growing frees, so construct first.
+                T value(std::forward<ArgTypes>(args)...);
+                Reserve(std::max<std::size_t>(m_Capacity * 2, 16));
+                std::construct_at(m_Elements + m_Size, std::move(value));
+            }
+            else
+            {
+                std::construct_at(m_Elements + m_Size, std::forward<ArgTypes>(args)...);
+            }
+            ++m_Size;
+        }
+
+        // The first element is preceded by `Arity - 1` unused slots, which puts the first child of node i (at i * Arity + 1)
+        // at slot (i + 1) * Arity of the allocation.
+        static constexpr std::size_t GetAllocationSize(const std::size_t capacity)
+        {
+            return ((capacity + Arity - 1) * sizeof(T) + CacheLineSize - 1) / CacheLineSize * CacheLineSize;
+        }
+
+        static constexpr std::align_val_t GetAllocationAlignment()
+        {
+            return std::align_val_t{std::max(CacheLineSize, alignof(T))};
+        }
+
+        void Free()
+        {
+            if (m_Allocation != nullptr)
+            {
+                ::operator delete(m_Allocation, GetAllocationSize(m_Capacity), GetAllocationAlignment());
+            }
+        }
+
+        void SiftUp(std::size_t index)
+        {
+            T value = std::move(m_Elements[index]);
+            while (index > 0)
+            {
+                const std::size_t parent = (index - 1) / Arity;
+                if (!m_Compare(m_Elements[parent], value))
+                {
+                    break;
+                }
+                m_Elements[index] = std::move(m_Elements[parent]);
+                index = parent;
+            }
+            m_Elements[index] = std::move(value);
+        }
+
+        void SiftDown(std::size_t index)
+        {
+            T value = std::move(m_Elements[index]);
+            while (true)
+            {
+                const std::size_t firstChild = index * Arity + 1;
+                if (firstChild >= m_Size)
+                {
+                    break;
+                }
+
+                const std::size_t lastChild = std::min(firstChild + Arity, m_Size);
+                std::size_t greatestChild = firstChild;
+                for (std::size_t child = firstChild + 1; child < lastChild; ++child)
+                {
+                    if (m_Compare(m_Elements[greatestChild], m_Elements[child]))
+                    {
+                        greatestChild = child;
+                    }
+                }
+
+                if (!m_Compare(value, m_Elements[greatestChild]))
+                {
+                    break;
+                }
+                m_Elements[index] = std::move(m_Elements[greatestChild]);
+                index = greatestChild;
+            }
+            m_Elements[index] = std::move(value);
+        }
+
+        /*
+        * Builds the heap bottom-up, from the last parent to the root.
+        */
+        void Heapify()
+        {
+            if (m_Size < 2)
+            {
+                return;
+            }
+            for (std::size_t parent = (m_Size - 2) / Arity + 1; parent-- > 0;)
+            {
+                SiftDown(parent);
+            }
+        }
+
+        std::byte* m_Allocation = nullptr;
+        T* m_Elements = nullptr;
+        std::size_t m_Size = 0;
+        std::size_t m_Capacity = 0;
+        [[no_unique_address]] CompareType m_Compare {};
+    };
+}
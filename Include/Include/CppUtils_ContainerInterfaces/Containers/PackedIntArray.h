@@ -0,0 +1,404 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_CpuFeatures.h>
+
+namespace CppUtils::Containers::Detail
+{
+    /*
+    * Elements are encoded in blocks of this many.
+    */
+    inline constexpr std::size_t PackedIntBlockSize = 128;
+
+    /*
+    * Packed blocks are split into this many interleaved 32-bit lanes, one SSE2 register wide. Element i is in lane i % 4,
+    * at position i / 4 of it. Each lane packs its 32 elements' bits consecutively (low bits first) into 32-bit words, and
+    * word w of every lane is stored together at words [w * 4, w * 4 + 4). So a block of bit width b is b * 4 words, and
+    * decoding works on all lanes at once with the same shifts and masks.
+    */
+    inline constexpr std::size_t PackedIntLaneCount = 4;
+    inline constexpr std::size_t PackedIntLaneLength = PackedIntBlockSize / PackedIntLaneCount;
+
+    constexpr std::uint32_t GetPackedIntMask(const std::uint32_t bitWidth)
+    {
+        return bitWidth == 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << bitWidth) - 1;
+    }
+
+    /*
+    * Packs a block of offsets, each fitting in the bit width (at most 32). Words must be zeroed.
+    */
+    inline void PackIntBlock(const std::uint32_t* const offsets, const std::uint32_t bitWidth, std::uint32_t* const words)
+    {
+        if (bitWidth == 0)
+        {
+            return;
+        }
+
+        for (std::size_t lane = 0; lane < PackedIntLaneCount; ++lane)
+        {
+            std::uint32_t bitPosition = 0;
+            for (std::size_t position = 0; position < PackedIntLaneLength; ++position)
+            {
+                const std::uint32_t offset = offsets[position * PackedIntLaneCount + lane];
+                const std::uint32_t word = bitPosition / 32;
+                const std::uint32_t shift = bitPosition % 32;
+
+                words[word * PackedIntLaneCount + lane] |= offset << shift;
+                if (shift + bitWidth > 32)
+                {
+                    words[(word + 1) * PackedIntLaneCount + lane] |= offset >> (32 - shift);
+                }
+                bitPosition += bitWidth;
+            }
+        }
+    }
+
+    inline void UnpackIntBlockScalar(const std::uint32_t* const words, const std::uint32_t bitWidth, std::uint32_t* const offsets)
+    {
+        if (bitWidth == 0)
+        {
+            std::fill_n(offsets, PackedIntBlockSize, 0);
+            return;
+        }
+
+        const std::uint32_t mask = GetPackedIntMask(bitWidth);
+        for (std::size_t lane = 0; lane < PackedIntLaneCount; ++lane)
+        {
+            std::uint32_t bitPosition = 0;
+            for (std::size_t position = 0; position < PackedIntLaneLength; ++position)
+            {
+                const std::uint32_t word = bitPosition / 32;
+                const std::uint32_t shift = bitPosition % 32;
+
+                std::uint32_t offset = words[word * PackedIntLaneCount + lane] >> shift;
+                if (shift + bitWidth > 32)
+                {
+                    offset |= words[(word + 1) * PackedIntLaneCount + lane] << (32 - shift);
+                }
+                offsets[position * PackedIntLaneCount + lane] = offset & mask;
+                bitPosition += bitWidth;
+            }
+        }
+    }
+
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+    /*
+    * Unpacks all four lanes at once. SSE2 is part of x86-64, so this needs no dispatch.
+    */
+    inline void UnpackIntBlockSse2(const std::uint32_t* const words, const std::uint32_t bitWidth, std::uint32_t* const offsets)
+    {
+        if (bitWidth == 0)
+        {
+            std::fill_n(offsets, PackedIntBlockSize, 0);
+            return;
+        }
+
+        const __m128i mask = _mm_set1_epi32(static_cast<int>(GetPackedIntMask(bitWidth)));
+        const __m128i* input = reinterpret_cast<const __m128i*>(words);
+        __m128i current = _mm_loadu_si128(input);
+        std::uint32_t shift = 0;
+        for (std::size_t position = 0; position < PackedIntLaneLength; ++position)
+        {
+            __m128i offset = _mm_srl_epi32(current, _mm_cvtsi32_si128(static_cast<int>(shift)));
+            shift += bitWidth;
+            if (shift >= 32)
+            {
+                shift -= 32;
+
+                // The last offsets end exactly at the end of the block's words.
+                if (position != PackedIntLaneLength - 1)
+                {
+                    current = _mm_loadu_si128(++input);
+                    offset = _mm_or_si128(offset, _mm_sll_epi32(current, _mm_cvtsi32_si128(static_cast<int>(bitWidth - shift))));
+                }
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(offsets + position * PackedIntLaneCount), _mm_and_si128(offset, mask));
+        }
+    }
+#endif
+
+    inline void UnpackIntBlock(const std::uint32_t* const words, const std::uint32_t bitWidth, std::uint32_t* const offsets)
+    {
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+        UnpackIntBlockSse2(words, bitWidth, offsets);
+#else
+        UnpackIntBlockScalar(words, bitWidth, offsets);
+#endif
+    }
+}
+
+namespace CppUtils::Containers
+{
+    template <class T>
+    class PackedIntArray;
+
+    /*
+    * Input iterator over a `PackedIntArray`. Elements are decoded on access, so they're read as values.
+    */
+    template <class T>
+    class PackedIntArrayIterator
+    {
+    public:
+
+        using value_type = T;
+        using reference = T;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::input_iterator_tag;
+
+        PackedIntArrayIterator() = default;
+
+        PackedIntArrayIterator(const PackedIntArray<T>& array, const std::size_t index)
+            : m_Array(std::addressof(array))
+            , m_Index(index)
+        {
+        }
+
+        reference operator*() const { return (*m_Array)[m_Index]; }
+
+        PackedIntArrayIterator& operator++() { ++m_Index; return *this; }
+        PackedIntArrayIterator operator++(int) { PackedIntArrayIterator copy = *this; ++m_Index; return copy; }
+
+        bool operator==(const PackedIntArrayIterator& other) const { return m_Index == other.m_Index; }
+
+    private:
+
+        const PackedIntArray<T>* m_Array = nullptr;
+        std::size_t m_Index = 0;
+    };
+
+    /*
+    * Read-only array of integers, compressed in blocks of 128. Each block is bit-packed with the fewest bits that fit it,
+    * after one of two encodings, whichever needs fewer bits:
+    *  - Frame of reference: offsets from the block's minimum. Suits small-range values (e.g. ids, enums, timestamps).
+    *  - Delta: differences from the element 4 positions before, which decode as 4 independent running sums. Suits sorted values
+    *    (e.g. posting lists), whose differences are much smaller than their range.
+    * Blocks that would need more than 32 bits per element are stored uncompressed.
+    *
+    * Element access decodes the element's whole block (with SIMD on x86-64) into a cache, so sequential reads only decode
+    * once per block. Random reads decode a block each. Prefer `Decode` or iteration for bulk reads.
+    *
+    * Reads update the cache, so concurrent reads of the same array are not safe. Give each thread its own copy.
+    */
+    template <class T>
+    class PackedIntArray
+    {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8, "Packed elements must be 8, 16, 32 or 64-bit integers.");
+
+        using UnsignedType = std::make_unsigned_t<T>;
+
+    public:
+
+        using value_type = T;
+        using Iterator = PackedIntArrayIterator<T>;
+
+        static constexpr std::size_t BlockSize = Detail::PackedIntBlockSize;
+
+        PackedIntArray() = default;
+
+        explicit PackedIntArray(const std::span<const T> values)
+            : m_Size(values.size())
+        {
+            m_Blocks.reserve((values.size() + BlockSize - 1) / BlockSize);
+            for (std::size_t blockStart = 0; blockStart < values.size(); blockStart += BlockSize)
+            {
+                EncodeBlock(values.subspan(blockStart, std::min(BlockSize, values.size() - blockStart)));
+            }
+            m_Words.shrink_to_fit();
+        }
+
+        PackedIntArray(const std::initializer_list<T> values)
+            : PackedIntArray(std::span<const T>(values.begin(), values.size()))
+        {
+        }
+
+        std::size_t GetSize() const { return m_Size; }
+        bool IsEmpty() const { return m_Size == 0; }
+        std::size_t GetBlockCount() const { return m_Blocks.size(); }
+
+        /*
+        * Elements are decoded on access, so they're returned by value.
+        */
+        T operator[](const std::size_t index) const
+        {
+            const std::size_t block = index / BlockSize;
+            if (block != m_CachedBlock)
+            {
+                DecodeBlock(block, m_Cache.data());
+                m_CachedBlock = block;
+            }
+            return m_Cache[index % BlockSize];
+        }
+
+        /*
+        * Decodes all elements to the output, which must have room for `GetSize()` elements. Bypasses the cache.
+        */
+        void Decode(T* output) const
+        {
+            for (std::size_t block = 0; block + 1 < m_Blocks.size(); ++block)
+            {
+                DecodeBlock(block, output);
+                output += BlockSize;
+            }
+            if (!m_Blocks.empty())
+            {
+                std::array<T, BlockSize> lastBlock;
+                DecodeBlock(m_Blocks.size() - 1, lastBlock.data());
+                std::copy_n(lastBlock.data(), m_Size - (m_Blocks.size() - 1) * BlockSize, output);
+            }
+        }
+
+        Iterator begin() const { return Iterator(*this, 0); }
+        Iterator end() const { return Iterator(*this, m_Size); }
+
+        ContainerOps::ContainerMemoryUsage GetMemoryUsage() const
+        {
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = m_Words.capacity() * sizeof(std::uint32_t) + m_Blocks.capacity() * sizeof(BlockHeader),
+                .InlineBytes = sizeof(*this),
+                .SlackBytes = (m_Words.capacity() - m_Words.size()) * sizeof(std::uint32_t) + (m_Blocks.capacity() - m_Blocks.size()) * sizeof(BlockHeader),
+            };
+        }
+
+    private:
+
+        enum class BlockEncoding : std::uint8_t
+        {
+            FrameOfReference,
+            Delta,
+            Uncompressed,
+        };
+
+        struct BlockHeader
+        {
+            // The minimum for frame of reference, the minimum of the first lane positions for delta.
+            UnsignedType Base;
+            std::uint32_t WordOffset;
+            std::uint8_t BitWidth;
+            BlockEncoding Encoding;
+        };
+
+        static constexpr std::size_t UncompressedWordCount = BlockSize * sizeof(UnsignedType) / sizeof(std::uint32_t);
+        static constexpr std::size_t NoCachedBlock = ~std::size_t{0};
+
+        void EncodeBlock(const std::span<const T> values)
+        {
+            // Padding repeats the last value, which widens neither encoding.
+            std::array<UnsignedType, BlockSize> block;
+            std::copy(values.begin(), values.end(), block.begin());
+            std::fill(block.begin() + values.size(), block.end(), static_cast<UnsignedType>(values.back()));
+
+            const auto [minimum, maximum] = std::minmax_element(block.begin(), block.end(), [](const UnsignedType lhs, const UnsignedType rhs)
+                {
+                    return static_cast<T>(lhs) < static_cast<T>(rhs);
+                });
+            const UnsignedType frameBase = *minimum;
+            const std::uint32_t frameBitWidth = static_cast<std::uint32_t>(std::bit_width(static_cast<UnsignedType>(*maximum - frameBase)));
+
+            // Wrapping differences of unsorted values come out huge, so delta is only picked for (mostly) sorted blocks.
+            const UnsignedType deltaBase = *std::min_element(block.begin(), block.begin() + Detail::PackedIntLaneCount, [](const UnsignedType lhs, const UnsignedType rhs)
+                {
+                    return static_cast<T>(lhs) < static_cast<T>(rhs);
+                });
+            std::array<UnsignedType, BlockSize> deltas;
+            UnsignedType deltaBits = 0;
+            for (std::size_t i = 0; i < BlockSize; ++i)
+            {
+                deltas[i] = static_cast<UnsignedType>(block[i] - (i < Detail::PackedIntLaneCount ? deltaBase : block[i - Detail::PackedIntLaneCount]));
+                deltaBits |= deltas[i];
+            }
+            const std::uint32_t deltaBitWidth = static_cast<std::uint32_t>(std::bit_width(deltaBits));
+
+            const bool bIsDelta = deltaBitWidth < frameBitWidth;
+            const std::uint32_t bitWidth = bIsDelta ? deltaBitWidth : frameBitWidth;
+
+            BlockHeader& header = m_Blocks.emplace_back();
+            header.WordOffset = static_cast<std::uint32_t>(m_Words.size());
+
+            if (bitWidth > 32)
+            {
+                header.Base = 0;
+                header.BitWidth = static_cast<std::uint8_t>(sizeof(UnsignedType) * 8);
+                header.Encoding = BlockEncoding::Uncompressed;
+                m_Words.resize(m_Words.size() + UncompressedWordCount);
+                std::memcpy(m_Words.data() + header.WordOffset, block.data(), sizeof(block));
+                return;
+            }
+
+            header.Base = bIsDelta ? deltaBase : frameBase;
+            header.BitWidth = static_cast<std::uint8_t>(bitWidth);
+            header.Encoding = bIsDelta ? BlockEncoding::Delta : BlockEncoding::FrameOfReference;
+
+            std::array<std::uint32_t, BlockSize> offsets;
+            for (std::size_t i = 0; i < BlockSize; ++i)
+            {
+                offsets[i] = static_cast<std::uint32_t>(bIsDelta ? deltas[i] : static_cast<UnsignedType>(block[i] - frameBase));
+            }
+            m_Words.resize(m_Words.size() + bitWidth * Detail::PackedIntLaneCount, 0);
+            Detail::PackIntBlock(offsets.data(), bitWidth, m_Words.data() + header.WordOffset);
+        }
+
+        /*
+        * Decodes a whole block, padding included, to the output.
+        */
+        void DecodeBlock(const std::size_t block, T* const output) const
+        {
+            const BlockHeader& header = m_Blocks[block];
+            const std::uint32_t* const words = m_Words.data() + header.WordOffset;
+
+            if (header.Encoding == BlockEncoding::Uncompressed)
+            {
+                std::memcpy(output, words, BlockSize * sizeof(T));
+                return;
+            }
+
+            std::array<std::uint32_t, BlockSize> offsets;
+            Detail::UnpackIntBlock(words, header.BitWidth, offsets.data());
+
+            if (header.Encoding == BlockEncoding::FrameOfReference)
+            {
+                for (std::size_t i = 0; i < BlockSize; ++i)
+                {
+                    output[i] = static_cast<T>(static_cast<UnsignedType>(header.Base + offsets[i]));
+                }
+            }
+            else
+            {
+                // Each lane is a running sum, so the sums are independent across lanes.
+                std::array<UnsignedType, Detail::PackedIntLaneCount> sums;
+                sums.fill(header.Base);
+                for (std::size_t i = 0; i < BlockSize; i += Detail::PackedIntLaneCount)
+                {
+                    for (std::size_t lane = 0; lane < Detail::PackedIntLaneCount; ++lane)
+                    {
+                        sums[lane] = static_cast<UnsignedType>(sums[lane] + offsets[i + lane]);
+                        output[i + lane] = static_cast<T>(sums[lane]);
+                    }
+                }
+            }
+        }
+
+        std::vector<BlockHeader> m_Blocks;
+        std::vector<std::uint32_t> m_Words;
+        std::size_t m_Size = 0;
+
+        mutable std::size_t m_CachedBlock = NoCachedBlock;
+        mutable std::array<T, BlockSize> m_Cache {};
+    };
+}
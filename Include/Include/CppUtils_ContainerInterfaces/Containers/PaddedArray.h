@@ -0,0 +1,63 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/CacheLinePadded.h>
+#include <CppUtils_ContainerInterfaces/Containers/ThreadIndex.h>
+
+namespace CppUtils::Containers
+{
+    /*
+    * Fixed size array whose elements each occupy their own cache line(s), so that threads writing to different elements
+    * don't invalidate each other's caches (false sharing). Meant for per-worker state such as counters and histograms,
+    * where each element costs at least `CacheLineSize` bytes but is written far more often than it's read.
+    *
+    * Elements aren't contiguous, so there is no `GetData`. Iterate or use the positional ops instead.
+    */
+    template <class T, std::size_t N>
+    class PaddedArray
+    {
+        static_assert(N > 0, "Padded arrays need at least one element to assign threads to.");
+
+    public:
+
+        using value_type = T;
+        using iterator = CacheLinePaddedIterator<T>;
+        using const_iterator = CacheLinePaddedIterator<const T>;
+
+        /*
+        * The element of the calling thread. Threads are assigned elements round robin, so more than `N` threads share
+        * elements, which must then be safe to access concurrently (e.g. atomics).
+        */
+        T& GetLocal() { return m_Elements[GetThreadIndex() % N].Value; }
+        const T& GetLocal() const { return m_Elements[GetThreadIndex() % N].Value; }
+
+        static constexpr std::size_t GetSize() { return N; }
+        static constexpr bool IsEmpty() { return N == 0; }
+
+        constexpr T& operator[](const std::size_t index) { return m_Elements[index].Value; }
+        constexpr const T& operator[](const std::size_t index) const { return m_Elements[index].Value; }
+
+        constexpr iterator begin() { return iterator(m_Elements.data()); }
+        constexpr iterator end() { return iterator(m_Elements.data() + N); }
+        constexpr const_iterator begin() const { return const_iterator(m_Elements.data()); }
+        constexpr const_iterator end() const { return const_iterator(m_Elements.data() + N); }
+
+        static constexpr ContainerOps::ContainerMemoryUsage GetMemoryUsage()
+        {
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = 0,
+                .InlineBytes = sizeof(PaddedArray),
+                .SlackBytes = 0,
+            };
+        }
+
+    private:
+
+        std::array<CacheLinePadded<T>, N> m_Elements {};
+    };
+}
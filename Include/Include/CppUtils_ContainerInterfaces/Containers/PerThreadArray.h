@@ -0,0 +1,73 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/CacheLinePadded.h>
+#include <CppUtils_ContainerInterfaces/Containers/ThreadIndex.h>
+
+namespace CppUtils::Containers
+{
+    /*
+    * `PaddedArray` sized at runtime, by default with one element per hardware thread. The size is fixed after construction,
+    * so references to elements stay valid for the array's lifetime. There's always at least one element to assign threads
+    * to, so a size of zero gets one, and the array is never empty.
+    */
+    template <class T>
+    class PerThreadArray
+    {
+    public:
+
+        using value_type = T;
+        using iterator = CacheLinePaddedIterator<T>;
+        using const_iterator = CacheLinePaddedIterator<const T>;
+
+        PerThreadArray()
+            : PerThreadArray(std::max<std::size_t>(std::thread::hardware_concurrency(), 1))
+        {
+        }
+
+        explicit PerThreadArray(const std::size_t size)
+            : m_Elements(std::make_unique<CacheLinePadded<T>[]>(std::max<std::size_t>(size, 1)))
+            , m_Size(std::max<std::size_t>(size, 1))
+        {
+        }
+
+        /*
+        * The element of the calling thread. Threads are assigned elements round robin, so more threads than elements share
+        * elements, which must then be safe to access concurrently (e.g. atomics).
+        */
+        T& GetLocal() { return m_Elements[GetThreadIndex() % m_Size].Value; }
+        const T& GetLocal() const { return m_Elements[GetThreadIndex() % m_Size].Value; }
+
+        std::size_t GetSize() const { return m_Size; }
+        bool IsEmpty() const { return false; }
+
+        T& operator[](const std::size_t index) { return m_Elements[index].Value; }
+        const T& operator[](const std::size_t index) const { return m_Elements[index].Value; }
+
+        iterator begin() { return iterator(m_Elements.get()); }
+        iterator end() { return iterator(m_Elements.get() + m_Size); }
+        const_iterator begin() const { return const_iterator(m_Elements.get()); }
+        const_iterator end() const { return const_iterator(m_Elements.get() + m_Size); }
+
+        ContainerOps::ContainerMemoryUsage GetMemoryUsage() const
+        {
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = m_Size * sizeof(CacheLinePadded<T>),
+                .InlineBytes = sizeof(*this),
+                .SlackBytes = 0,
+            };
+        }
+
+    private:
+
+        std::unique_ptr<CacheLinePadded<T>[]> m_Elements;
+        std::size_t m_Size;
+    };
+}
@@ -0,0 +1,316 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+
+#if defined(__linux__)
+#   include <sys/mman.h>
+#endif
+
+namespace CppUtils::Containers
+{
+    /*
+    * Size of the (transparent) huge pages that blocks can be backed by.
+    */
+    inline constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+
+    /*
+    * Random access iterator over a `SegmentedVector`'s elements. `T` is const for const iteration.
+    */
+    template <class T, std::size_t BlockShift>
+    class SegmentedVectorIterator
+    {
+    public:
+
+        using value_type = std::remove_const_t<T>;
+        using reference = T&;
+        using pointer = T*;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        using BlockPointerType = std::conditional_t<std::is_const_v<T>, value_type* const*, value_type**>;
+
+        SegmentedVectorIterator() = default;
+
+        SegmentedVectorIterator(const BlockPointerType blocks, const std::size_t index)
+            : m_Blocks(blocks)
+            , m_Index(static_cast<difference_type>(index))
+        {
+        }
+
+        operator SegmentedVectorIterator<const T, BlockShift>() const
+            requires (!std::is_const_v<T>)
+        {
+            return SegmentedVectorIterator<const T, BlockShift>(m_Blocks, static_cast<std::size_t>(m_Index));
+        }
+
+        reference operator*() const { return (*this)[0]; }
+        pointer operator->() const { return std::addressof(**this); }
+
+        reference operator[](const difference_type offset) const
+        {
+            const std::size_t index = static_cast<std::size_t>(m_Index + offset);
+            return m_Blocks[index >> BlockShift][index & ((std::size_t{1} << BlockShift) - 1)];
+        }
+
+        SegmentedVectorIterator& operator++() { ++m_Index; return *this; }
+        SegmentedVectorIterator& operator--() { --m_Index; return *this; }
+        SegmentedVectorIterator operator++(int) { SegmentedVectorIterator copy = *this; ++m_Index; return copy; }
+        SegmentedVectorIterator operator--(int) { SegmentedVectorIterator copy = *this; --m_Index; return copy; }
+
+        SegmentedVectorIterator& operator+=(const difference_type offset) { m_Index += offset; return *this; }
+        SegmentedVectorIterator& operator-=(const difference_type offset) { m_Index -= offset; return *this; }
+
+        SegmentedVectorIterator operator+(const difference_type offset) const { SegmentedVectorIterator copy = *this; return copy += offset; }
+        SegmentedVectorIterator operator-(const difference_type offset) const { SegmentedVectorIterator copy = *this; return copy -= offset; }
+        friend SegmentedVectorIterator operator+(const difference_type offset, const SegmentedVectorIterator& iterator) { return iterator + offset; }
+
+        difference_type operator-(const SegmentedVectorIterator& other) const { return m_Index - other.m_Index; }
+
+        bool operator==(const SegmentedVectorIterator& other) const { return m_Index == other.m_Index; }
+        std::strong_ordering operator<=>(const SegmentedVectorIterator& other) const { return m_Index <=> other.m_Index; }
+
+    private:
+
+        BlockPointerType m_Blocks = nullptr;
+        difference_type m_Index = 0;
+    };
+
+    /*
+    * Vector that grows by allocating fixed-size blocks of `BlockBytes` (rounded down to a power of two elements), and never
+    * reallocates or moves its elements. So growth costs no copies, and pointers to elements stay valid until they're erased.
+    * Element access is an index split into block and offset with a shift and a mask, plus one lookup in the block table.
+    *
+    * Blocks can be backed by transparent huge pages, which cuts TLB misses over large vectors. They're then aligned to (and
+    * padded to a multiple of) the huge page size, and advised with `madvise(MADV_HUGEPAGE)` on Linux. Elsewhere, or if the
+    * system has huge pages disabled, they're ordinary memory.
+    *
+    * Elements aren't contiguous across blocks, so `GetData` isn't implemented.
+    */
+    template <class T, std::size_t BlockBytes = HugePageSize>
+    class SegmentedVector
+    {
+        static constexpr std::size_t ElementsPerBlock = std::bit_floor(std::max<std::size_t>(BlockBytes / sizeof(T), 1));
+
+    public:
+
+        using value_type = T;
+
+        static constexpr std::size_t BlockShift = std::countr_zero(ElementsPerBlock);
+
+        using Iterator = SegmentedVectorIterator<T, BlockShift>;
+        using ConstIterator = SegmentedVectorIterator<const T, BlockShift>;
+
+        SegmentedVector() = default;
+
+        explicit SegmentedVector(const bool bUseHugePages)
+            : m_bUseHugePages(bUseHugePages)
+        {
+        }
+
+        // Delegates so that the vector is constructed before copying, and its dtor frees the copies so far if one throws.
+        SegmentedVector(const SegmentedVector& other)
+            : SegmentedVector(other.m_bUseHugePages)
+        {
+            Reserve(other.m_Size);
+            for (const T& element : other)
+            {
+                EmplaceBack(element);
+            }
+        }
+
+        SegmentedVector(SegmentedVector&& other) noexcept
+            : m_Blocks(std::move(other.m_Blocks))
+            , m_Size(std::exchange(other.m_Size, 0))
+            , m_bUseHugePages(other.m_bUseHugePages)
+        {
+            other.m_Blocks.clear();
+        }
+
+        SegmentedVector& operator=(SegmentedVector other) noexcept
+        {
+            std::swap(m_Blocks, other.m_Blocks);
+            std::swap(m_Size, other.m_Size);
+            std::swap(m_bUseHugePages, other.m_bUseHugePages);
+            return *this;
+        }
+
+        ~SegmentedVector()
+        {
+            Clear();
+            for (T* const block : m_Blocks)
+            {
+                FreeBlock(block);
+            }
+        }
+
+        template <class... ArgTypes>
+        T& EmplaceBack(ArgTypes&&... args)
+        {
+            if (m_Size == GetCapacity())
+            {
+                AllocateBlock();
+            }
+
+            T* const element = ::new (static_cast<void*>(GetElementAddress(m_Size))) T(std::forward<ArgTypes>(args)...);
+            ++m_Size;
+            return *element;
+        }
+
+        T& PushBack(const T& value) { return EmplaceBack(value); }
+        T& PushBack(T&& value) { return EmplaceBack(std::move(value)); }
+
+        void PopBack()
+        {
+            --m_Size;
+            std::destroy_at(GetElementAddress(m_Size));
+        }
+
+        /*
+        * Allocates blocks until there's room for the capacity.
+        */
+        void Reserve(const std::size_t capacity)
+        {
+            m_Blocks.reserve((capacity + ElementsPerBlock - 1) >> BlockShift);
+            while (GetCapacity() < capacity)
+            {
+                AllocateBlock();
+            }
+        }
+
+        /*
+        * Destroys elements from the back until there are at most `size`.
+        */
+        void Truncate(const std::size_t size)
+        {
+            while (m_Size > size)
+            {
+                PopBack();
+            }
+        }
+
+        void Clear() { Truncate(0); }
+
+        /*
+        * Moves the last element into the index's place.
+        */
+        void EraseAtUnordered(const std::size_t index)
+        {
+            if (index != m_Size - 1)
+            {
+                (*this)[index] = std::move((*this)[m_Size - 1]);
+            }
+            PopBack();
+        }
+
+        /*
+        * Shifts the elements after the index down by one.
+        */
+        void EraseAtOrdered(const std::size_t index)
+        {
+            std::move(begin() + static_cast<std::ptrdiff_t>(index) + 1, end(), begin() + static_cast<std::ptrdiff_t>(index));
+            PopBack();
+        }
+
+        /*
+        * Frees the blocks beyond the one holding the last element.
+        */
+        void ShrinkToFit()
+        {
+            const std::size_t usedBlockCount = (m_Size + ElementsPerBlock - 1) >> BlockShift;
+            while (m_Blocks.size() > usedBlockCount)
+            {
+                FreeBlock(m_Blocks.back());
+                m_Blocks.pop_back();
+            }
+            m_Blocks.shrink_to_fit();
+        }
+
+        std::size_t GetSize() const { return m_Size; }
+        std::size_t GetCapacity() const { return m_Blocks.size() << BlockShift; }
+        bool IsEmpty() const { return m_Size == 0; }
+
+        static constexpr std::size_t GetElementsPerBlock() { return ElementsPerBlock; }
+        std::size_t GetBlockCount() const { return m_Blocks.size(); }
+
+        T& operator[](const std::size_t index) { return *GetElementAddress(index); }
+        const T& operator[](const std::size_t index) const { return *GetElementAddress(index); }
+
+        Iterator begin() { return Iterator(m_Blocks.data(), 0); }
+        Iterator end() { return Iterator(m_Blocks.data(), m_Size); }
+        ConstIterator begin() const { return ConstIterator(m_Blocks.data(), 0); }
+        ConstIterator end() const { return ConstIterator(m_Blocks.data(), m_Size); }
+
+        ContainerOps::ContainerMemoryUsage GetMemoryUsage() const
+        {
+            const std::size_t blockBytes = m_Blocks.size() * GetBlockAllocationSize();
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = blockBytes + m_Blocks.capacity() * sizeof(T*),
+                .InlineBytes = sizeof(*this),
+                .SlackBytes = blockBytes - m_Size * sizeof(T) + (m_Blocks.capacity() - m_Blocks.size()) * sizeof(T*),
+            };
+        }
+
+    private:
+
+        static constexpr std::size_t OffsetMask = ElementsPerBlock - 1;
+
+        T* GetElementAddress(const std::size_t index) const
+        {
+            return m_Blocks[index >> BlockShift] + (index & OffsetMask);
+        }
+
+        std::size_t GetBlockAllocationSize() const
+        {
+            const std::size_t elementBytes = ElementsPerBlock * sizeof(T);
+            return m_bUseHugePages ? (elementBytes + HugePageSize - 1) / HugePageSize * HugePageSize : elementBytes;
+        }
+
+        std::align_val_t GetBlockAlignment() const
+        {
+            return std::align_val_t{m_bUseHugePages ? HugePageSize : std::max(alignof(T), alignof(std::max_align_t))};
+        }
+
+        void AllocateBlock()
+        {
+            // Make room in the table first, so a failure to add the block can't leak it.
+            if (m_Blocks.size() == m_Blocks.capacity())
+            {
+                m_Blocks.reserve(std::max<std::size_t>(m_Blocks.capacity() * 2, 8));
+            }
+
+            const std::size_t size = GetBlockAllocationSize();
+            void* const block = ::operator new(size, GetBlockAlignment());
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            if (m_bUseHugePages)
+            {
+                // Only advisory. Failing (e.g. with huge pages disabled) leaves the block backed by ordinary pages.
+                ::madvise(block, size, MADV_HUGEPAGE);
+            }
+#endif
+            m_Blocks.push_back(static_cast<T*>(block));
+        }
+
+        void FreeBlock(T* const block) const
+        {
+            ::operator delete(static_cast<void*>(block), GetBlockAllocationSize(), GetBlockAlignment());
+        }
+
+        std::vector<T*> m_Blocks;
+        std::size_t m_Size = 0;
+        bool m_bUseHugePages = false;
+    };
+}
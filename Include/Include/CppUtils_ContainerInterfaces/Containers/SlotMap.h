@@ -0,0 +1,210 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+
+namespace CppUtils::Containers
+{
+    /*
+    * Stable reference to an element of a `SlotMap`. Stays valid until its element is erased, after which it never refers
+    * to another element (barring generation wraparound after 2^31 reuses of the same slot).
+    */
+    struct SlotMapHandle
+    {
+        std::uint32_t Index = ~std::uint32_t{0};
+
+        // Odd while the slot is occupied, so the default handle (generation 0) never refers to an element.
+        std::uint32_t Generation = 0;
+
+        constexpr bool operator==(const SlotMapHandle&) const = default;
+    };
+
+    /*
+    * Densely stored elements addressed by generational handles.
+    *
+    * Elements live contiguously in insertion order, except that erasing moves the last element into the erased one's place.
+    * So iteration and positional access (the `GetElement` op, etc.) are plain array accesses. Handles go through one level of
+    * indirection, a slot table entry holding the element's dense index. Insert, erase and handle lookup are O(1).
+    *
+    * Erasing and inserting don't invalidate handles to other elements, but do invalidate pointers to elements.
+    */
+    template <class T>
+    class SlotMap
+    {
+    public:
+
+        using value_type = T;
+        using HandleType = SlotMapHandle;
+
+        template <class... ArgTypes>
+        constexpr SlotMapHandle Emplace(ArgTypes&&... args)
+        {
+            // Everything that can throw happens before the slot is taken, so a throwing element ctor leaves the map's
+            // elements and handles unchanged. New slots join the free list, and the dense to slot table makes room first.
+            if (m_FreeSlotHead == NullIndex)
+            {
+                m_Slots.push_back(Slot{});
+                m_FreeSlotHead = static_cast<std::uint32_t>(m_Slots.size() - 1);
+            }
+            if (m_DenseToSlot.size() == m_DenseToSlot.capacity())
+            {
+                m_DenseToSlot.reserve(std::max<std::size_t>(m_DenseToSlot.capacity() * 2, 8));
+            }
+
+            m_Dense.emplace_back(std::forward<ArgTypes>(args)...);
+
+            const std::uint32_t slotIndex = m_FreeSlotHead;
+            m_DenseToSlot.push_back(slotIndex);
+            m_FreeSlotHead = m_Slots[slotIndex].DenseIndexOrNextFree;
+
+            Slot& slot = m_Slots[slotIndex];
+            slot.DenseIndexOrNextFree = static_cast<std::uint32_t>(m_Dense.size() - 1);
+            ++slot.Generation;
+            return SlotMapHandle{ .Index = slotIndex, .Generation = slot.Generation };
+        }
+
+        constexpr SlotMapHandle Insert(const T& value) { return Emplace(value); }
+        constexpr SlotMapHandle Insert(T&& value) { return Emplace(std::move(value)); }
+
+        /*
+        * Erases the handle's element, if it still exists. Returns whether it did.
+        */
+        constexpr bool Erase(const SlotMapHandle handle)
+        {
+            if (!Contains(handle))
+            {
+                return false;
+            }
+
+            EraseAt(m_Slots[handle.Index].DenseIndexOrNextFree);
+            return true;
+        }
+
+        /*
+        * Erases the element at the dense index, moving the last element into its place.
+        */
+        constexpr void EraseAt(const std::size_t denseIndex)
+        {
+            const std::uint32_t erasedSlotIndex = m_DenseToSlot[denseIndex];
+            const std::size_t lastDenseIndex = m_Dense.size() - 1;
+
+            if (denseIndex != lastDenseIndex)
+            {
+                m_Dense[denseIndex] = std::move(m_Dense[lastDenseIndex]);
+                m_DenseToSlot[denseIndex] = m_DenseToSlot[lastDenseIndex];
+                m_Slots[m_DenseToSlot[denseIndex]].DenseIndexOrNextFree = static_cast<std::uint32_t>(denseIndex);
+            }
+            m_Dense.pop_back();
+            m_DenseToSlot.pop_back();
+
+            Slot& erasedSlot = m_Slots[erasedSlotIndex];
+            ++erasedSlot.Generation;
+            erasedSlot.DenseIndexOrNextFree = m_FreeSlotHead;
+            m_FreeSlotHead = erasedSlotIndex;
+        }
+
+        constexpr bool Contains(const SlotMapHandle handle) const
+        {
+            return handle.Index < m_Slots.size() && m_Slots[handle.Index].Generation == handle.Generation;
+        }
+
+        /*
+        * Returns the handle's element, or null if it was erased.
+        */
+        constexpr T* Find(const SlotMapHandle handle)
+        {
+            return Contains(handle) ? &m_Dense[m_Slots[handle.Index].DenseIndexOrNextFree] : nullptr;
+        }
+
+        constexpr const T* Find(const SlotMapHandle handle) const
+        {
+            return Contains(handle) ? &m_Dense[m_Slots[handle.Index].DenseIndexOrNextFree] : nullptr;
+        }
+
+        /*
+        * Returns the handle of the element at the dense index.
+        */
+        constexpr SlotMapHandle GetHandle(const std::size_t denseIndex) const
+        {
+            const std::uint32_t slotIndex = m_DenseToSlot[denseIndex];
+            return SlotMapHandle{ .Index = slotIndex, .Generation = m_Slots[slotIndex].Generation };
+        }
+
+        constexpr void Reserve(const std::size_t capacity)
+        {
+            m_Dense.reserve(capacity);
+            m_DenseToSlot.reserve(capacity);
+            m_Slots.reserve(capacity);
+        }
+
+        /*
+        * Erases all elements. Their handles stay invalid after their slots are reused.
+        */
+        constexpr void Clear()
+        {
+            while (!m_Dense.empty())
+            {
+                EraseAt(m_Dense.size() - 1);
+            }
+        }
+
+        /*
+        * Releases unused capacity of the dense storage. The slot table keeps its size, since live handles may refer to any slot.
+        */
+        constexpr void ShrinkToFit()
+        {
+            m_Dense.shrink_to_fit();
+            m_DenseToSlot.shrink_to_fit();
+        }
+
+        constexpr std::size_t GetSize() const { return m_Dense.size(); }
+        constexpr std::size_t GetCapacity() const { return m_Dense.capacity(); }
+        constexpr bool IsEmpty() const { return m_Dense.empty(); }
+
+        constexpr T* GetData() { return m_Dense.data(); }
+        constexpr const T* GetData() const { return m_Dense.data(); }
+
+        constexpr T& operator[](const std::size_t denseIndex) { return m_Dense[denseIndex]; }
+        constexpr const T& operator[](const std::size_t denseIndex) const { return m_Dense[denseIndex]; }
+
+        constexpr T* begin() { return m_Dense.data(); }
+        constexpr T* end() { return m_Dense.data() + m_Dense.size(); }
+        constexpr const T* begin() const { return m_Dense.data(); }
+        constexpr const T* end() const { return m_Dense.data() + m_Dense.size(); }
+
+        constexpr ContainerOps::ContainerMemoryUsage GetMemoryUsage() const
+        {
+            const std::size_t freeSlotCount = m_Slots.size() - m_Dense.size();
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = m_Dense.capacity() * sizeof(T) + m_DenseToSlot.capacity() * sizeof(std::uint32_t) + m_Slots.capacity() * sizeof(Slot),
+                .InlineBytes = sizeof(*this),
+                .SlackBytes = (m_Dense.capacity() - m_Dense.size()) * sizeof(T)
+                    + (m_DenseToSlot.capacity() - m_DenseToSlot.size()) * sizeof(std::uint32_t)
+                    + (m_Slots.capacity() - m_Slots.size() + freeSlotCount) * sizeof(Slot),
+            };
+        }
+
+    private:
+
+        static constexpr std::uint32_t NullIndex = ~std::uint32_t{0};
+
+        struct Slot
+        {
+            // The element's index into the dense storage while occupied, otherwise the next free slot.
+            std::uint32_t DenseIndexOrNextFree = NullIndex;
+            std::uint32_t Generation = 0;
+        };
+
+        std::vector<T> m_Dense;
+        std::vector<std::uint32_t> m_DenseToSlot;
+        std::vector<Slot> m_Slots;
+        std::uint32_t m_FreeSlotHead = NullIndex;
+    };
+}
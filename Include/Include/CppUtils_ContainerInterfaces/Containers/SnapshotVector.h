@@ -0,0 +1,297 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/Containers/CacheLinePadded.h>
+#include <CppUtils_ContainerInterfaces/Containers/ThreadIndex.h>
+
+namespace CppUtils::Containers::Detail
+{
+    /*
+    * Count of readers inside a snapshot, for each of the two reader epochs (parities).
+    */
+    using SnapshotReaderCounters = std::array<std::atomic<std::uint32_t>, 2>;
+}
+
+namespace CppUtils::Containers
+{
+    /*
+    * Immutable view of one version of a `SnapshotVector`'s elements. The version stays alive for as long as the snapshot does.
+    * Snapshots should be short lived (e.g. one request), since they hold back reclamation of every version retired after them.
+    */
+    template <class T>
+    class VectorSnapshot
+    {
+    public:
+
+        using value_type = T;
+
+        VectorSnapshot(const std::vector<T>& elements, std::atomic<std::uint32_t>& readerCounter)
+            : m_Elements(&elements)
+            , m_ReaderCounter(&readerCounter)
+        {
+        }
+
+        VectorSnapshot(const VectorSnapshot&) = delete;
+        VectorSnapshot& operator=(const VectorSnapshot&) = delete;
+
+        VectorSnapshot(VectorSnapshot&& other) noexcept
+            : m_Elements(std::exchange(other.m_Elements, nullptr))
+            , m_ReaderCounter(std::exchange(other.m_ReaderCounter, nullptr))
+        {
+        }
+
+        VectorSnapshot& operator=(VectorSnapshot&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Release();
+                m_Elements = std::exchange(other.m_Elements, nullptr);
+                m_ReaderCounter = std::exchange(other.m_ReaderCounter, nullptr);
+            }
+            return *this;
+        }
+
+        ~VectorSnapshot()
+        {
+            Release();
+        }
+
+        std::size_t GetSize() const { return m_Elements->size(); }
+        bool IsEmpty() const { return m_Elements->empty(); }
+
+        const T* GetData() const { return m_Elements->data(); }
+
+        const T& operator[](const std::size_t index) const { return (*m_Elements)[index]; }
+
+        const T* begin() const { return m_Elements->data(); }
+        const T* end() const { return m_Elements->data() + m_Elements->size(); }
+
+    private:
+
+        void Release()
+        {
+            if (m_ReaderCounter != nullptr)
+            {
+                m_ReaderCounter->fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        // Null once moved from.
+        const std::vector<T>* m_Elements;
+        std::atomic<std::uint32_t>* m_ReaderCounter;
+    };
+
+    /*
+    * Read-mostly vector. Readers take immutable snapshots without locking, writers publish whole new versions.
+    *
+    * Taking a snapshot is one atomic increment of a reader counter and one load of the current version. Reader counters are
+    * striped over cache lines by thread, so readers on different cores don't contend with each other, and never touch any
+    * cache line a writer writes to besides the (rarely changing) current version and epoch.
+    *
+    * Publishing swaps in the new version and retires the old one, which stays alive until `ReclaimRetired` observes that no
+    * snapshot can still refer to it. Reclamation uses two reader epochs: readers count themselves under the current epoch,
+    * and a retired version is freed once the epoch has been flipped twice after its retirement, with the counters of the
+    * epoch flipped away from drained both times. Reclamation never waits on readers, it just makes what progress it can.
+    *
+    * Writers serialize with each other. Snapshots must not outlive the vector.
+    */
+    template <class T>
+    class SnapshotVector
+    {
+    public:
+
+        using value_type = T;
+        using Snapshot = VectorSnapshot<T>;
+
+        SnapshotVector()
+            : SnapshotVector(std::vector<T>{})
+        {
+        }
+
+        explicit SnapshotVector(std::vector<T> elements)
+            : m_Current(new std::vector<T>(std::move(elements)))
+            , m_ReaderStripeCount(std::bit_ceil(std::max<std::size_t>(std::thread::hardware_concurrency(), 1)))
+            , m_ReaderStripes(std::make_unique<CacheLinePadded<Detail::SnapshotReaderCounters>[]>(m_ReaderStripeCount))
+        {
+        }
+
+        SnapshotVector(const SnapshotVector&) = delete;
+        SnapshotVector& operator=(const SnapshotVector&) = delete;
+
+        ~SnapshotVector()
+        {
+            assert(IsEpochDrained(0) && IsEpochDrained(1) && "Snapshots must not outlive their vector.");
+
+            delete m_Current.load(std::memory_order_relaxed);
+            for (const std::vector<T>* const version : m_Retired)
+            {
+                delete version;
+            }
+            for (const std::vector<T>* const version : m_Reclaiming)
+            {
+                delete version;
+            }
+        }
+
+        /*
+        * Takes a snapshot of the current version. Lock free, and safe to call concurrently with everything but destruction.
+        */
+        Snapshot GetSnapshot() const
+        {
+            const std::size_t stripe = GetThreadIndex() & (m_ReaderStripeCount - 1);
+
+            // Counting ourselves before loading the version pairs with `ReclaimRetired` retiring versions before checking
+            // the counters. Either it sees our count, or we see a version published after the one it's reclaiming.
+            const std::uint32_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+            std::atomic<std::uint32_t>& readerCounter = m_ReaderStripes[stripe].Value[epoch];
+            readerCounter.fetch_add(1, std::memory_order_seq_cst);
+
+            return Snapshot(*m_Current.load(std::memory_order_seq_cst), readerCounter);
+        }
+
+        /*
+        * Replaces the elements, retiring the previous version.
+        */
+        void Publish(std::vector<T> elements)
+        {
+            const std::lock_guard lock(m_WriterMutex);
+            PublishLocked(new std::vector<T>(std::move(elements)));
+        }
+
+        /*
+        * Copies the current elements, applies the mutator to the copy, and publishes it. Concurrent updates don't lose each
+        * other's changes.
+        */
+        template <class MutatorType>
+        void Update(MutatorType&& mutator)
+        {
+            const std::lock_guard lock(m_WriterMutex);
+            std::unique_ptr<std::vector<T>> elements = std::make_unique<std::vector<T>>(*m_Current.load(std::memory_order_relaxed));
+            std::forward<MutatorType>(mutator)(*elements);
+            PublishLocked(elements.release());
+        }
+
+        /*
+        * Frees retired versions that no snapshot can refer to anymore. Returns how many were freed.
+        *
+        * Doesn't wait for readers. Versions still possibly in use are left for a later call, so call this periodically
+        * (e.g. after publishing, or from a housekeeping thread).
+        */
+        std::size_t ReclaimRetired()
+        {
+            const std::lock_guard lock(m_WriterMutex);
+
+            std::size_t freedCount = 0;
+            while (true)
+            {
+                switch (m_ReclaimPhase)
+                {
+                    case ReclaimPhase::Idle:
+                    {
+                        if (m_Retired.empty())
+                        {
+                            return freedCount;
+                        }
+                        m_Reclaiming = std::move(m_Retired);
+                        m_Retired.clear();
+                        FlipEpoch();
+                        m_ReclaimPhase = ReclaimPhase::AwaitingFirstDrain;
+                        break;
+                    }
+                    case ReclaimPhase::AwaitingFirstDrain:
+                    {
+                        if (!IsEpochDrained(m_Epoch.load(std::memory_order_relaxed) ^ 1))
+                        {
+                            return freedCount;
+                        }
+                        // Readers that loaded the epoch before the previous flip may still count themselves under the other one.
+                        FlipEpoch();
+                        m_ReclaimPhase = ReclaimPhase::AwaitingSecondDrain;
+                        break;
+                    }
+                    case ReclaimPhase::AwaitingSecondDrain:
+                    {
+                        if (!IsEpochDrained(m_Epoch.load(std::memory_order_relaxed) ^ 1))
+                        {
+                            return freedCount;
+                        }
+                        for (const std::vector<T>* const version : m_Reclaiming)
+                        {
+                            delete version;
+                        }
+                        freedCount += m_Reclaiming.size();
+                        m_Reclaiming.clear();
+                        m_ReclaimPhase = ReclaimPhase::Idle;
+                        break;
+                    }
+                }
+            }
+        }
+
+        /*
+        * Number of versions awaiting reclamation.
+        */
+        std::size_t GetRetiredCount() const
+        {
+            const std::lock_guard lock(m_WriterMutex);
+            return m_Retired.size() + m_Reclaiming.size();
+        }
+
+    private:
+
+        enum class ReclaimPhase : std::uint8_t
+        {
+            Idle,
+            AwaitingFirstDrain,
+            AwaitingSecondDrain,
+        };
+
+        void PublishLocked(const std::vector<T>* const elements)
+        {
+            m_Retired.push_back(m_Current.exchange(elements, std::memory_order_seq_cst));
+        }
+
+        void FlipEpoch()
+        {
+            m_Epoch.store(m_Epoch.load(std::memory_order_relaxed) ^ 1, std::memory_order_seq_cst);
+        }
+
+        bool IsEpochDrained(const std::uint32_t epoch) const
+        {
+            for (std::size_t stripe = 0; stripe < m_ReaderStripeCount; ++stripe)
+            {
+                if (m_ReaderStripes[stripe].Value[epoch].load(std::memory_order_seq_cst) != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Read by every snapshot, written only on publish and reclaim.
+        alignas(CacheLineSize) std::atomic<const std::vector<T>*> m_Current;
+        std::atomic<std::uint32_t> m_Epoch = 0;
+
+        std::size_t m_ReaderStripeCount;
+        std::unique_ptr<CacheLinePadded<Detail::SnapshotReaderCounters>[]> m_ReaderStripes;
+
+        // Writer state, on its own cache line(s) to keep writers from invalidating the reader state above.
+        alignas(CacheLineSize) mutable std::mutex m_WriterMutex;
+        std::vector<const std::vector<T>*> m_Retired;
+        std::vector<const std::vector<T>*> m_Reclaiming;
+        ReclaimPhase m_ReclaimPhase = ReclaimPhase::Idle;
+    };
+}
@@ -0,0 +1,254 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+
+namespace CppUtils::Containers
+{
+    /*
+    * Elements keyed by integer ids, stored densely for iteration.
+    *
+    * A sparse array maps each id to its element's index in the dense storage. The sparse array is split into pages which are
+    * only allocated once an id in their range is used, so its memory is proportional to the id ranges in use rather than the
+    * largest id. Membership tests and lookups are two array reads, and insert and erase are O(1).
+    *
+    * Erasing moves the last element into the erased one's place, so the dense order isn't stable. Inserting and erasing
+    * invalidate pointers to elements.
+    *
+    * Elements are only readable by position and through iteration, since reordering them would break the id mapping.
+    * Modify them through `Find` instead.
+    */
+    template <class T, std::size_t PageSize = 4096>
+    class SparseSet
+    {
+        static_assert(std::has_single_bit(PageSize), "Page size must be a power of two.");
+
+    public:
+
+        using value_type = T;
+        using IdType = std::uint32_t;
+        using HandleType = IdType;
+
+        /*
+        * Constructs the id's element from the arguments, replacing its existing element if any.
+        */
+        template <class... ArgTypes>
+        T& Emplace(const IdType id, ArgTypes&&... args)
+        {
+            std::uint32_t& denseIndex = GetOrAllocateSparseEntry(id);
+            if (denseIndex != NullIndex)
+            {
+                T& element = m_Dense[denseIndex];
+                element = T(std::forward<ArgTypes>(args)...);
+                return element;
+            }
+
+            // Make room for the id first, so a failure can't leave the element without one.
+            if (m_DenseIds.size() == m_DenseIds.capacity())
+            {
+                m_DenseIds.reserve(std::max<std::size_t>(m_DenseIds.capacity() * 2, 8));
+            }
+
+            T& element = m_Dense.emplace_back(std::forward<ArgTypes>(args)...);
+            m_DenseIds.push_back(id);
+            denseIndex = static_cast<std::uint32_t>(m_Dense.size() - 1);
+            return element;
+        }
+
+        T& Insert(const IdType id, const T& value) { return Emplace(id, value); }
+        T& Insert(const IdType id, T&& value) { return Emplace(id, std::move(value)); }
+
+        /*
+        * Erases the id's element, if any. Returns whether it did.
+        */
+        bool Erase(const IdType id)
+        {
+            const std::uint32_t* const sparseEntry = FindSparseEntry(id);
+            if (sparseEntry == nullptr || *sparseEntry == NullIndex)
+            {
+                return false;
+            }
+
+            EraseAt(*sparseEntry);
+            return true;
+        }
+
+        /*
+        * Erases the element at the dense index, moving the last element into its place.
+        */
+        void EraseAt(const std::size_t denseIndex)
+        {
+            const IdType erasedId = m_DenseIds[denseIndex];
+            const std::size_t lastDenseIndex = m_Dense.size() - 1;
+
+            if (denseIndex != lastDenseIndex)
+            {
+                m_Dense[denseIndex] = std::move(m_Dense[lastDenseIndex]);
+                m_DenseIds[denseIndex] = m_DenseIds[lastDenseIndex];
+                GetSparseEntry(m_DenseIds[denseIndex]) = static_cast<std::uint32_t>(denseIndex);
+            }
+            m_Dense.pop_back();
+            m_DenseIds.pop_back();
+
+            GetSparseEntry(erasedId) = NullIndex;
+        }
+
+        bool Contains(const IdType id) const
+        {
+            const std::uint32_t* const sparseEntry = FindSparseEntry(id);
+            return sparseEntry != nullptr && *sparseEntry != NullIndex;
+        }
+
+        /*
+        * Returns the id's element, or null if it has none.
+        */
+        T* Find(const IdType id)
+        {
+            return const_cast<T*>(std::as_const(*this).Find(id));
+        }
+
+        const T* Find(const IdType id) const
+        {
+            const std::uint32_t* const sparseEntry = FindSparseEntry(id);
+            return sparseEntry != nullptr && *sparseEntry != NullIndex ? &m_Dense[*sparseEntry] : nullptr;
+        }
+
+        /*
+        * Returns the id of the element at the dense index.
+        */
+        IdType GetId(const std::size_t denseIndex) const { return m_DenseIds[denseIndex]; }
+
+        /*
+        * The ids of the elements, in the same order as the elements.
+        */
+        const IdType* GetIdData() const { return m_DenseIds.data(); }
+
+        void Reserve(const std::size_t capacity)
+        {
+            m_Dense.reserve(capacity);
+            m_DenseIds.reserve(capacity);
+        }
+
+        /*
+        * Erases all elements. Sparse pages stay allocated for reuse.
+        */
+        void Clear()
+        {
+            for (const IdType id : m_DenseIds)
+            {
+                GetSparseEntry(id) = NullIndex;
+            }
+            m_Dense.clear();
+            m_DenseIds.clear();
+        }
+
+        /*
+        * Releases unused capacity of the dense storage, and sparse pages that no longer map any id.
+        */
+        void ShrinkToFit()
+        {
+            m_Dense.shrink_to_fit();
+            m_DenseIds.shrink_to_fit();
+
+            std::vector<bool> bIsPageUsed(m_SparsePages.size(), false);
+            for (const IdType id : m_DenseIds)
+            {
+                bIsPageUsed[id / PageSize] = true;
+            }
+            for (std::size_t page = 0; page < m_SparsePages.size(); ++page)
+            {
+                if (!bIsPageUsed[page])
+                {
+                    m_SparsePages[page].reset();
+                }
+            }
+            while (!m_SparsePages.empty() && m_SparsePages.back() == nullptr)
+            {
+                m_SparsePages.pop_back();
+            }
+            m_SparsePages.shrink_to_fit();
+        }
+
+        std::size_t GetSize() const { return m_Dense.size(); }
+        std::size_t GetCapacity() const { return m_Dense.capacity(); }
+        bool IsEmpty() const { return m_Dense.empty(); }
+
+        const T* GetData() const { return m_Dense.data(); }
+
+        const T& operator[](const std::size_t denseIndex) const { return m_Dense[denseIndex]; }
+
+        const T* begin() const { return m_Dense.data(); }
+        const T* end() const { return m_Dense.data() + m_Dense.size(); }
+
+        ContainerOps::ContainerMemoryUsage GetMemoryUsage() const
+        {
+            std::size_t allocatedPageCount = 0;
+            for (const std::unique_ptr<std::uint32_t[]>& page : m_SparsePages)
+            {
+                allocatedPageCount += page != nullptr;
+            }
+
+            const std::size_t sparseBytes = allocatedPageCount * PageSize * sizeof(std::uint32_t);
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = m_Dense.capacity() * sizeof(T) + m_DenseIds.capacity() * sizeof(IdType)
+                    + m_SparsePages.capacity() * sizeof(std::unique_ptr<std::uint32_t[]>) + sparseBytes,
+                .InlineBytes = sizeof(*this),
+                .SlackBytes = (m_Dense.capacity() - m_Dense.size()) * sizeof(T)
+                    + (m_DenseIds.capacity() - m_DenseIds.size()) * sizeof(IdType)
+                    + sparseBytes - m_Dense.size() * sizeof(std::uint32_t),
+            };
+        }
+
+    private:
+
+        static constexpr std::uint32_t NullIndex = ~std::uint32_t{0};
+
+        const std::uint32_t* FindSparseEntry(const IdType id) const
+        {
+            const std::size_t page = id / PageSize;
+            if (page >= m_SparsePages.size() || m_SparsePages[page] == nullptr)
+            {
+                return nullptr;
+            }
+            return &m_SparsePages[page][id % PageSize];
+        }
+
+        /*
+        * Only for ids known to have an allocated page.
+        */
+        std::uint32_t& GetSparseEntry(const IdType id)
+        {
+            return m_SparsePages[id / PageSize][id % PageSize];
+        }
+
+        std::uint32_t& GetOrAllocateSparseEntry(const IdType id)
+        {
+            const std::size_t page = id / PageSize;
+            if (page >= m_SparsePages.size())
+            {
+                m_SparsePages.resize(page + 1);
+            }
+
+            if (m_SparsePages[page] == nullptr)
+            {
+                m_SparsePages[page] = std::make_unique_for_overwrite<std::uint32_t[]>(PageSize);
+                std::fill_n(m_SparsePages[page].get(), PageSize, NullIndex);
+            }
+
+            return m_SparsePages[page][id % PageSize];
+        }
+
+        std::vector<T> m_Dense;
+        std::vector<IdType> m_DenseIds;
+        std::vector<std::unique_ptr<std::uint32_t[]>> m_SparsePages;
+    };
+}
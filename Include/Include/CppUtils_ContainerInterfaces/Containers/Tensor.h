@@ -0,0 +1,275 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <vector>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+
+/*
+* Layouts map a multi-index to a position in a tensor's storage, like `std::mdspan`'s layout policies. Each provides a
+* `Mapping<Rank>` constructible from the extents.
+*/
+namespace CppUtils::Containers
+{
+    /*
+    * The last dimension is contiguous (C order).
+    */
+    struct LayoutRowMajor
+    {
+        template <std::size_t Rank>
+        class Mapping
+        {
+        public:
+
+            constexpr explicit Mapping(const std::array<std::size_t, Rank>& extents)
+                : m_Extents(extents)
+            {
+                std::size_t stride = 1;
+                for (std::size_t dimension = Rank; dimension-- > 0;)
+                {
+                    m_Strides[dimension] = stride;
+                    stride *= extents[dimension];
+                }
+            }
+
+            constexpr std::size_t operator()(const std::array<std::size_t, Rank>& index) const
+            {
+                std::size_t offset = 0;
+                for (std::size_t dimension = 0; dimension < Rank; ++dimension)
+                {
+                    offset += index[dimension] * m_Strides[dimension];
+                }
+                return offset;
+            }
+
+            constexpr std::size_t GetRequiredStorageSize() const
+            {
+                if constexpr (Rank == 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return m_Strides[0] * m_Extents[0];
+                }
+            }
+
+            constexpr const std::array<std::size_t, Rank>& GetExtents() const { return m_Extents; }
+
+        private:
+
+            std::array<std::size_t, Rank> m_Extents;
+            std::array<std::size_t, Rank> m_Strides {};
+        };
+    };
+
+    /*
+    * The first dimension is contiguous (Fortran order).
+    */
+    struct LayoutColumnMajor
+    {
+        template <std::size_t Rank>
+        class Mapping
+        {
+        public:
+
+            constexpr explicit Mapping(const std::array<std::size_t, Rank>& extents)
+                : m_Extents(extents)
+            {
+                std::size_t stride = 1;
+                for (std::size_t dimension = 0; dimension < Rank; ++dimension)
+                {
+                    m_Strides[dimension] = stride;
+                    stride *= extents[dimension];
+                }
+            }
+
+            constexpr std::size_t operator()(const std::array<std::size_t, Rank>& index) const
+            {
+                std::size_t offset = 0;
+                for (std::size_t dimension = 0; dimension < Rank; ++dimension)
+                {
+                    offset += index[dimension] * m_Strides[dimension];
+                }
+                return offset;
+            }
+
+            constexpr std::size_t GetRequiredStorageSize() const
+            {
+                if constexpr (Rank == 0)
+                {
+                    return 1;
+                }
+                else
+                {
+                    return m_Strides[Rank - 1] * m_Extents[Rank - 1];
+                }
+            }
+
+            constexpr const std::array<std::size_t, Rank>& GetExtents() const { return m_Extents; }
+
+        private:
+
+            std::array<std::size_t, Rank> m_Extents;
+            std::array<std::size_t, Rank> m_Strides {};
+        };
+    };
+
+    /*
+    * Storage is split into tiles (blocks) of `TileSize` elements along every dimension. Tiles are contiguous and stored in
+    * row-major order, as are the elements within each tile. Neighbors in any dimension are then usually in the same tile,
+    * which keeps stencils and other 2D/3D access patterns cache (and TLB) friendly where row-major would stride through
+    * memory along all but the last dimension.
+    *
+    * Extents are padded up to whole tiles, so storage may hold more elements than the tensor.
+    */
+    template <std::size_t TileSize>
+    struct LayoutTiled
+    {
+        static_assert(std::has_single_bit(TileSize), "Tile size must be a power of two.");
+
+        template <std::size_t Rank>
+        class Mapping
+        {
+            static constexpr std::size_t TileShift = std::countr_zero(TileSize);
+
+        public:
+
+            constexpr explicit Mapping(const std::array<std::size_t, Rank>& extents)
+                : m_Extents(extents)
+            {
+                std::size_t tileStride = 1;
+                for (std::size_t dimension = Rank; dimension-- > 0;)
+                {
+                    m_TileStrides[dimension] = tileStride;
+                    tileStride *= (extents[dimension] + TileSize - 1) >> TileShift;
+                }
+                m_TileCount = tileStride;
+            }
+
+            constexpr std::size_t operator()(const std::array<std::size_t, Rank>& index) const
+            {
+                std::size_t tile = 0;
+                std::size_t offsetInTile = 0;
+                for (std::size_t dimension = 0; dimension < Rank; ++dimension)
+                {
+                    tile += (index[dimension] >> TileShift) * m_TileStrides[dimension];
+                    offsetInTile = (offsetInTile << TileShift) | (index[dimension] & (TileSize - 1));
+                }
+                return tile * TileVolume + offsetInTile;
+            }
+
+            constexpr std::size_t GetRequiredStorageSize() const
+            {
+                return m_TileCount * TileVolume;
+            }
+
+            constexpr const std::array<std::size_t, Rank>& GetExtents() const { return m_Extents; }
+
+        private:
+
+            static constexpr std::size_t TileVolume = std::size_t{1} << (TileShift * Rank);
+
+            std::array<std::size_t, Rank> m_Extents;
+
+            // Strides between tiles, in tiles.
+            std::array<std::size_t, Rank> m_TileStrides {};
+            std::size_t m_TileCount = 0;
+        };
+    };
+}
+
+namespace CppUtils::Containers
+{
+    /*
+    * Owning multidimensional array with a fixed rank and a choice of layout. Elements are addressed by multi-index, either
+    * through `operator[]` with a `std::array`, `operator()` with one index per dimension, or the `GetElementND` op.
+    *
+    * Iteration and `GetData` cover the raw storage in layout order, including any padding the layout adds.
+    */
+    template <class T, std::size_t Rank, class LayoutType = LayoutRowMajor>
+    class Tensor
+    {
+    public:
+
+        using value_type = T;
+        using element_type = T;
+        using IndexType = std::array<std::size_t, Rank>;
+        using MappingType = typename LayoutType::template Mapping<Rank>;
+
+        Tensor()
+            : Tensor(IndexType{})
+        {
+        }
+
+        explicit Tensor(const IndexType& extents, const T& value = T{})
+            : m_Mapping(extents)
+            , m_Storage(m_Mapping.GetRequiredStorageSize(), value)
+        {
+        }
+
+        static constexpr std::size_t GetRank() { return Rank; }
+
+        std::size_t GetExtent(const std::size_t dimension) const { return m_Mapping.GetExtents()[dimension]; }
+        const IndexType& GetExtents() const { return m_Mapping.GetExtents(); }
+
+        /*
+        * Number of elements, excluding layout padding.
+        */
+        std::size_t GetSize() const
+        {
+            std::size_t size = 1;
+            for (const std::size_t extent : m_Mapping.GetExtents())
+            {
+                size *= extent;
+            }
+            return size;
+        }
+
+        const MappingType& GetMapping() const { return m_Mapping; }
+
+        T& operator[](const IndexType& index) { return m_Storage[m_Mapping(index)]; }
+        const T& operator[](const IndexType& index) const { return m_Storage[m_Mapping(index)]; }
+
+        template <class... IndexTypes>
+            requires (sizeof...(IndexTypes) == Rank)
+        T& operator()(const IndexTypes... indices)
+        {
+            return m_Storage[m_Mapping(IndexType{ static_cast<std::size_t>(indices)... })];
+        }
+
+        template <class... IndexTypes>
+            requires (sizeof...(IndexTypes) == Rank)
+        const T& operator()(const IndexTypes... indices) const
+        {
+            return m_Storage[m_Mapping(IndexType{ static_cast<std::size_t>(indices)... })];
+        }
+
+        T* GetData() { return m_Storage.data(); }
+        const T* GetData() const { return m_Storage.data(); }
+        std::size_t GetStorageSize() const { return m_Storage.size(); }
+
+        T* begin() { return m_Storage.data(); }
+        T* end() { return m_Storage.data() + m_Storage.size(); }
+        const T* begin() const { return m_Storage.data(); }
+        const T* end() const { return m_Storage.data() + m_Storage.size(); }
+
+        ContainerOps::ContainerMemoryUsage GetMemoryUsage() const
+        {
+            return ContainerOps::ContainerMemoryUsage
+            {
+                .HeapBytes = m_Storage.capacity() * sizeof(T),
+                .InlineBytes = sizeof(*this),
+                .SlackBytes = (m_Storage.capacity() - GetSize()) * sizeof(T),
+            };
+        }
+
+    private:
+
+        MappingType m_Mapping;
+        std::vector<T> m_Storage;
+    };
+}
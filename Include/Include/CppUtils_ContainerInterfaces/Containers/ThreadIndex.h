@@ -0,0 +1,20 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace CppUtils::Containers
+{
+    /*
+    * Small index identifying the calling thread, assigned in order of each thread's first call. Unlike `std::thread::id`,
+    * it can index per-thread storage directly. Indices aren't reused after their threads exit.
+    */
+    inline std::size_t GetThreadIndex()
+    {
+        static std::atomic<std::size_t> nextIndex = 0;
+        thread_local const std::size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+}
@@ -0,0 +1,471 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Transform.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Stride.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Slice.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Filter.h>
+#include <CppUtils_ContainerInterfaces/ContainerViews/ContainerViews_Concat.h>
+
+/*
+* Views implement the read-side ops lazily over the container they wrap, so generic code taking any container can take
+* a subset or projection of one without copying it. Views can wrap other views.
+*
+* `IsValidIndex` of a `FilterView` without a cached index scans the container, like its `GetSize`.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ContainerType, class ProjectionType>
+    struct ContainerOp_GetSize<T, ContainerViews::TransformView<ContainerType, ProjectionType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const ContainerViews::TransformView<ContainerType, ProjectionType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType, class ProjectionType>
+    struct ContainerOp_IsEmpty<T, ContainerViews::TransformView<ContainerType, ProjectionType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const ContainerViews::TransformView<ContainerType, ProjectionType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_View.IsEmpty();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType, class ProjectionType>
+    struct ContainerOp_IsValidIndex<T, ContainerViews::TransformView<ContainerType, ProjectionType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const ContainerViews::TransformView<ContainerType, ProjectionType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType, class ProjectionType>
+    struct ContainerOp_GetElement<T, ContainerViews::TransformView<ContainerType, ProjectionType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const ContainerViews::TransformView<ContainerType, ProjectionType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(ContainerViews::TransformView<ContainerType, ProjectionType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr const typename ContainerViews::TransformView<ContainerType, ProjectionType>::element_type& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+        constexpr typename ContainerViews::TransformView<ContainerType, ProjectionType>::element_type& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_GetSize<T, ContainerViews::StrideView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const ContainerViews::StrideView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_IsEmpty<T, ContainerViews::StrideView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const ContainerViews::StrideView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_View.IsEmpty();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_IsValidIndex<T, ContainerViews::StrideView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const ContainerViews::StrideView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_GetElement<T, ContainerViews::StrideView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const ContainerViews::StrideView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(ContainerViews::StrideView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr const typename ContainerViews::StrideView<ContainerType>::element_type& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+        constexpr typename ContainerViews::StrideView<ContainerType>::element_type& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_GetSize<T, ContainerViews::SliceView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const ContainerViews::SliceView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_IsEmpty<T, ContainerViews::SliceView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const ContainerViews::SliceView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_View.IsEmpty();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_IsValidIndex<T, ContainerViews::SliceView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const ContainerViews::SliceView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+    struct ContainerOp_GetElement<T, ContainerViews::SliceView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const ContainerViews::SliceView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(ContainerViews::SliceView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr const typename ContainerViews::SliceView<ContainerType>::element_type& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+        constexpr typename ContainerViews::SliceView<ContainerType>::element_type& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType>
+        requires IsContainerOpImplemented<ContainerOp_GetData, ContainerType>
+    struct ContainerOp_GetData<T, ContainerViews::SliceView<ContainerType>>
+    {
+        constexpr explicit ContainerOp_GetData(const ContainerViews::SliceView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(ContainerViews::SliceView<ContainerType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr const typename ContainerViews::SliceView<ContainerType>::element_type* Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_View.GetData();
+        }
+
+        constexpr typename ContainerViews::SliceView<ContainerType>::element_type* Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_View.GetData();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType, class PredicateType>
+    struct ContainerOp_GetSize<T, ContainerViews::FilterView<ContainerType, PredicateType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const ContainerViews::FilterView<ContainerType, PredicateType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType, class PredicateType>
+    struct ContainerOp_IsEmpty<T, ContainerViews::FilterView<ContainerType, PredicateType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const ContainerViews::FilterView<ContainerType, PredicateType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_View.IsEmpty();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType, class PredicateType>
+    struct ContainerOp_IsValidIndex<T, ContainerViews::FilterView<ContainerType, PredicateType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const ContainerViews::FilterView<ContainerType, PredicateType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class ContainerType, class PredicateType>
+    struct ContainerOp_GetElement<T, ContainerViews::FilterView<ContainerType, PredicateType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const ContainerViews::FilterView<ContainerType, PredicateType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(ContainerViews::FilterView<ContainerType, PredicateType>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr const typename ContainerViews::FilterView<ContainerType, PredicateType>::element_type& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+        constexpr typename ContainerViews::FilterView<ContainerType, PredicateType>::element_type& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class... ContainerTypes>
+    struct ContainerOp_GetSize<T, ContainerViews::ConcatView<ContainerTypes...>>
+    {
+        constexpr explicit ContainerOp_GetSize(const ContainerViews::ConcatView<ContainerTypes...>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class... ContainerTypes>
+    struct ContainerOp_IsEmpty<T, ContainerViews::ConcatView<ContainerTypes...>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const ContainerViews::ConcatView<ContainerTypes...>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_View.IsEmpty();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class... ContainerTypes>
+    struct ContainerOp_IsValidIndex<T, ContainerViews::ConcatView<ContainerTypes...>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const ContainerViews::ConcatView<ContainerTypes...>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_View.GetSize();
+        }
+
+private:
+
+        T m_View;
+    };
+
+    template <class T, class... ContainerTypes>
+    struct ContainerOp_GetElement<T, ContainerViews::ConcatView<ContainerTypes...>>
+    {
+        constexpr explicit ContainerOp_GetElement(const ContainerViews::ConcatView<ContainerTypes...>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(ContainerViews::ConcatView<ContainerTypes...>& view)
+            : m_View(view)
+        {
+        }
+
+        constexpr const typename ContainerViews::ConcatView<ContainerTypes...>::element_type& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+        constexpr typename ContainerViews::ConcatView<ContainerTypes...>::element_type& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_View[index];
+        }
+
+private:
+
+        T m_View;
+    };
+}
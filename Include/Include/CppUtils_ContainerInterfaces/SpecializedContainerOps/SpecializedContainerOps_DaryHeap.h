@@ -0,0 +1,111 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/DaryHeap.h>
+
+/*
+* The front of a heap is its top element. Only the top has a meaningful position, so the other positional ops aren't
+* implemented. Elements are const even through non-const heaps, since modifying them could break the heap.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType, std::size_t Arity, class CompareType>
+    struct ContainerOp_GetCapacity<T, Containers::DaryHeap<ElementType, Arity, CompareType>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const Containers::DaryHeap<ElementType, Arity, CompareType>& heap)
+            : m_Heap(heap)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_Heap.GetCapacity();
+        }
+
+private:
+
+        T m_Heap;
+    };
+
+    template <class T, class ElementType, std::size_t Arity, class CompareType>
+    struct ContainerOp_GetSize<T, Containers::DaryHeap<ElementType, Arity, CompareType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::DaryHeap<ElementType, Arity, CompareType>& heap)
+            : m_Heap(heap)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_Heap.GetSize();
+        }
+
+private:
+
+        T m_Heap;
+    };
+
+    template <class T, class ElementType, std::size_t Arity, class CompareType>
+    struct ContainerOp_IsEmpty<T, Containers::DaryHeap<ElementType, Arity, CompareType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const Containers::DaryHeap<ElementType, Arity, CompareType>& heap)
+            : m_Heap(heap)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_Heap.IsEmpty();
+        }
+
+private:
+
+        T m_Heap;
+    };
+
+    template <class T, class ElementType, std::size_t Arity, class CompareType>
+    struct ContainerOp_GetFront<T, Containers::DaryHeap<ElementType, Arity, CompareType>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::DaryHeap<ElementType, Arity, CompareType>& heap)
+            : m_Heap(heap)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::DaryHeap<ElementType, Arity, CompareType>& heap)
+            : m_Heap(heap)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+        {
+            return m_Heap.GetTop();
+        }
+
+private:
+
+        T m_Heap;
+    };
+
+    template <class T, class ElementType, std::size_t Arity, class CompareType>
+    struct ContainerOp_GetMemoryUsage<T, Containers::DaryHeap<ElementType, Arity, CompareType>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const Containers::DaryHeap<ElementType, Arity, CompareType>& heap)
+            : m_Heap(heap)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return m_Heap.GetMemoryUsage();
+        }
+
+private:
+
+        T m_Heap;
+    };
+}
@@ -0,0 +1,174 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/Containers/PackedIntArray.h>
+
+/*
+* Packed arrays are read-only, so only the observer ops are implemented, and element access is const even through
+* non-const arrays. Elements are decoded on access, so they're returned by value. Capacity is the size, since packed
+* arrays are built once at their final size.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType>
+    struct ContainerOp_GetCapacity<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        std::size_t Do() const
+        {
+            return m_Array.GetSize();
+        }
+
+private:
+
+        T m_Array;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetSize<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        std::size_t Do() const
+        {
+            return m_Array.GetSize();
+        }
+
+private:
+
+        T m_Array;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsValidIndex<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        bool Do(const std::size_t index) const
+        {
+            return index < m_Array.GetSize();
+        }
+
+private:
+
+        T m_Array;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsEmpty<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        bool Do() const
+        {
+            return m_Array.IsEmpty();
+        }
+
+private:
+
+        T m_Array;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetFront<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        ElementType Do() const
+        {
+            return m_Array[0];
+        }
+
+private:
+
+        T m_Array;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetBack<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetBack(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        ElementType Do() const
+        {
+            return m_Array[m_Array.GetSize() - 1];
+        }
+
+private:
+
+        T m_Array;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetElement<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        ElementType Do(const std::size_t index) const
+        {
+            return m_Array[index];
+        }
+
+private:
+
+        T m_Array;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetMemoryUsage<T, Containers::PackedIntArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const Containers::PackedIntArray<ElementType>& array)
+            : m_Array(array)
+        {
+        }
+
+        ContainerMemoryUsage Do() const
+        {
+            return m_Array.GetMemoryUsage();
+        }
+
+private:
+
+        T m_Array;
+    };
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/PaddedArray.h>
+
+/*
+* Padded elements aren't contiguous, so there is no `GetData`. Generic code reducing over the array (e.g. summing per-thread
+* counters) goes through `GetElement` or the array's iterators.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_GetCapacity<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        consteval explicit ContainerOp_GetCapacity(const Containers::PaddedArray<ElementType, Size>&)
+        {
+        }
+
+        consteval std::size_t Do() const
+        {
+            return Size;
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_GetSize<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        consteval explicit ContainerOp_GetSize(const Containers::PaddedArray<ElementType, Size>&)
+        {
+        }
+
+        consteval std::size_t Do() const
+        {
+            return Size;
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_IsValidIndex<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        consteval explicit ContainerOp_IsValidIndex(const Containers::PaddedArray<ElementType, Size>&)
+        {
+        }
+
+        consteval bool Do(const std::size_t index) const
+        {
+            return index < Size;
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_IsEmpty<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        consteval explicit ContainerOp_IsEmpty(const Containers::PaddedArray<ElementType, Size>&)
+        {
+        }
+
+        consteval bool Do() const
+        {
+            return Size == 0;
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_GetFront<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::PaddedArray<ElementType, Size>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::PaddedArray<ElementType, Size>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr[0];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr[0];
+        }
+
+private:
+
+        T m_Arr;
+    };
+
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_GetBack<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        constexpr explicit ContainerOp_GetBack(const Containers::PaddedArray<ElementType, Size>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(Containers::PaddedArray<ElementType, Size>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr[m_Arr.GetSize() - 1];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr[m_Arr.GetSize() - 1];
+        }
+
+private:
+
+        T m_Arr;
+    };
+
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_GetElement<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        constexpr explicit ContainerOp_GetElement(const Containers::PaddedArray<ElementType, Size>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(Containers::PaddedArray<ElementType, Size>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr[index];
+        }
+
+        constexpr ElementType& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr[index];
+        }
+
+private:
+
+        T m_Arr;
+    };
+
+    template <class T, class ElementType, std::size_t Size>
+    struct ContainerOp_GetMemoryUsage<T, Containers::PaddedArray<ElementType, Size>>
+    {
+        consteval explicit ContainerOp_GetMemoryUsage(const Containers::PaddedArray<ElementType, Size>&)
+        {
+        }
+
+        consteval ContainerMemoryUsage Do() const
+        {
+            return Containers::PaddedArray<ElementType, Size>::GetMemoryUsage();
+        }
+    };
+}
@@ -0,0 +1,194 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/PerThreadArray.h>
+
+/*
+* The array's size is fixed at construction, so its capacity is its size. Like `PaddedArray`, there is no `GetData`.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType>
+    struct ContainerOp_GetCapacity<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_PerThreadArray.GetSize();
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetSize<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_PerThreadArray.GetSize();
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsValidIndex<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_PerThreadArray.GetSize();
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsEmpty<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_PerThreadArray.IsEmpty();
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetFront<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_PerThreadArray[0];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_PerThreadArray[0];
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetBack<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetBack(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_PerThreadArray[m_PerThreadArray.GetSize() - 1];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_PerThreadArray[m_PerThreadArray.GetSize() - 1];
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetElement<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_PerThreadArray[index];
+        }
+
+        constexpr ElementType& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_PerThreadArray[index];
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetMemoryUsage<T, Containers::PerThreadArray<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const Containers::PerThreadArray<ElementType>& perThreadArray)
+            : m_PerThreadArray(perThreadArray)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return m_PerThreadArray.GetMemoryUsage();
+        }
+
+private:
+
+        T m_PerThreadArray;
+    };
+}
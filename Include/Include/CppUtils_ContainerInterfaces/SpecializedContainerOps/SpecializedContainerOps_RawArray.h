@@ -5,6 +5,7 @@
 #include <array>
 #include <CppUtils/Misc/TypeTraits.h>
 #include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
 
 /*
 * Some raw array details to keep in mind:
@@ -147,6 +148,62 @@ private:
             return m_Arr[index];
         }
         
+private:
+
+        T m_Arr {};
+    };
+
+    template <class T, class ElementType, std::size_t Capacity>
+    struct ContainerOp_GetMemoryUsage<T, ElementType[Capacity]>
+    {
+        consteval explicit ContainerOp_GetMemoryUsage(const ElementType (&)[Capacity])
+        {
+        }
+
+        consteval ContainerMemoryUsage Do() const
+        {
+            return ContainerMemoryUsage{ .InlineBytes = sizeof(ElementType[Capacity]) };
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Capacity>
+    struct ContainerOp_ShrinkToFit<T, ElementType[Capacity]>
+    {
+        consteval explicit ContainerOp_ShrinkToFit(ElementType (&)[Capacity])
+        {
+        }
+
+        consteval void Do() const
+        {
+            // Nothing to release, storage is inline.
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Capacity>
+    struct ContainerOp_GetData<T, ElementType[Capacity]>
+    {
+        constexpr explicit ContainerOp_GetData(const ElementType (&arr)[Capacity])
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(ElementType (&arr)[Capacity])
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr const ElementType* Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr;
+        }
+
+        constexpr ElementType* Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr;
+        }
+
 private:
 
         T m_Arr {};
@@ -0,0 +1,268 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/SegmentedVector.h>
+
+/*
+* Capacity covers whole allocated blocks, and shrinking frees the blocks past the last element. `GetData` isn't implemented,
+* since elements are only contiguous within a block.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_GetCapacity<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_SegmentedVector.GetCapacity();
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_GetSize<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_SegmentedVector.GetSize();
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_IsValidIndex<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_SegmentedVector.GetSize();
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_IsEmpty<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_SegmentedVector.IsEmpty();
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_GetFront<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SegmentedVector[0];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SegmentedVector[0];
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_GetBack<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_GetBack(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SegmentedVector[m_SegmentedVector.GetSize() - 1];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SegmentedVector[m_SegmentedVector.GetSize() - 1];
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_GetElement<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_GetElement(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SegmentedVector[index];
+        }
+
+        constexpr ElementType& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SegmentedVector[index];
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_GetMemoryUsage<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return m_SegmentedVector.GetMemoryUsage();
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_ShrinkToFit<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_ShrinkToFit(Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr void Do() const
+        {
+            m_SegmentedVector.ShrinkToFit();
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_EraseAtUnordered<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_EraseAtUnordered(Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            m_SegmentedVector.EraseAtUnordered(index);
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_EraseAtOrdered<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_EraseAtOrdered(Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            m_SegmentedVector.EraseAtOrdered(index);
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+
+    template <class T, class ElementType, std::size_t BlockBytes>
+    struct ContainerOp_Truncate<T, Containers::SegmentedVector<ElementType, BlockBytes>>
+    {
+        constexpr explicit ContainerOp_Truncate(Containers::SegmentedVector<ElementType, BlockBytes>& segmentedVector)
+            : m_SegmentedVector(segmentedVector)
+        {
+        }
+
+        constexpr void Do(const std::size_t size) const
+        {
+            m_SegmentedVector.Truncate(size);
+        }
+
+private:
+
+        T m_SegmentedVector;
+    };
+}
@@ -0,0 +1,286 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/SlotMap.h>
+
+/*
+* Positional ops address the slot map's dense storage. Erasing by position is unordered, since that's how the slot map
+* keeps its storage dense. Note that reordering elements through these ops (e.g. sorting) also changes which element
+* each handle refers to.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType>
+    struct ContainerOp_GetCapacity<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr std::size_t Do() const { return m_SlotMap.GetCapacity(); }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetSize<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr std::size_t Do() const { return m_SlotMap.GetSize(); }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsValidIndex<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_SlotMap.GetSize();
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsEmpty<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_SlotMap.IsEmpty();
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetFront<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap[0];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap[0];
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetBack<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetBack(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap[m_SlotMap.GetSize() - 1];
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap[m_SlotMap.GetSize() - 1];
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetElement<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap[index];
+        }
+
+        constexpr ElementType& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap[index];
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetMemoryUsage<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return m_SlotMap.GetMemoryUsage();
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_ShrinkToFit<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_ShrinkToFit(Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr void Do() const
+        {
+            m_SlotMap.ShrinkToFit();
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetData<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetData(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr const ElementType* Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap.GetData();
+        }
+
+        constexpr ElementType* Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap.GetData();
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_EraseAtUnordered<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_EraseAtUnordered(Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            m_SlotMap.EraseAt(index);
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_FindByHandle<T, Containers::SlotMap<ElementType>>
+    {
+        constexpr explicit ContainerOp_FindByHandle(const Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr explicit ContainerOp_FindByHandle(Containers::SlotMap<ElementType>& slotMap)
+            : m_SlotMap(slotMap)
+        {
+        }
+
+        constexpr const ElementType* Do(const Containers::SlotMapHandle handle) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap.Find(handle);
+        }
+
+        constexpr ElementType* Do(const Containers::SlotMapHandle handle) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_SlotMap.Find(handle);
+        }
+
+private:
+
+        T m_SlotMap;
+    };
+}
@@ -0,0 +1,160 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/Containers/SnapshotVector.h>
+
+/*
+* Ops are implemented for snapshots rather than the `SnapshotVector` itself, since reading its elements is only safe
+* through a snapshot. Snapshots are immutable, so element access is const even through non-const snapshots.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType>
+    struct ContainerOp_GetSize<T, Containers::VectorSnapshot<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        std::size_t Do() const
+        {
+            return m_Snapshot.GetSize();
+        }
+
+private:
+
+        T m_Snapshot;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsValidIndex<T, Containers::VectorSnapshot<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        bool Do(const std::size_t index) const
+        {
+            return index < m_Snapshot.GetSize();
+        }
+
+private:
+
+        T m_Snapshot;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsEmpty<T, Containers::VectorSnapshot<ElementType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        bool Do() const
+        {
+            return m_Snapshot.IsEmpty();
+        }
+
+private:
+
+        T m_Snapshot;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetFront<T, Containers::VectorSnapshot<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        const ElementType& Do() const
+        {
+            return m_Snapshot[0];
+        }
+
+private:
+
+        T m_Snapshot;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetBack<T, Containers::VectorSnapshot<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetBack(const Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        const ElementType& Do() const
+        {
+            return m_Snapshot[m_Snapshot.GetSize() - 1];
+        }
+
+private:
+
+        T m_Snapshot;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetElement<T, Containers::VectorSnapshot<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        const ElementType& Do(const std::size_t index) const
+        {
+            return m_Snapshot[index];
+        }
+
+private:
+
+        T m_Snapshot;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetData<T, Containers::VectorSnapshot<ElementType>>
+    {
+        constexpr explicit ContainerOp_GetData(const Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(Containers::VectorSnapshot<ElementType>& snapshot)
+            : m_Snapshot(snapshot)
+        {
+        }
+
+        const ElementType* Do() const
+        {
+            return m_Snapshot.GetData();
+        }
+
+private:
+
+        T m_Snapshot;
+    };
+}
@@ -0,0 +1,252 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/SparseSet.h>
+
+/*
+* Positional ops address the sparse set's dense storage. `FindByHandle` takes an id. Elements are const through all ops,
+* even on non-const sets, so generic code can't reorder them behind the id mapping (e.g. by sorting). Modify elements
+* through the set's own `Find` instead.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_GetCapacity<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr std::size_t Do() const { return m_SparseSet.GetCapacity(); }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_GetSize<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr std::size_t Do() const { return m_SparseSet.GetSize(); }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_IsValidIndex<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_SparseSet.GetSize();
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_IsEmpty<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_SparseSet.IsEmpty();
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_GetFront<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_GetFront(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+        {
+            return m_SparseSet[0];
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_GetBack<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_GetBack(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+        {
+            return m_SparseSet[m_SparseSet.GetSize() - 1];
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_GetElement<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_GetElement(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::size_t index) const
+        {
+            return m_SparseSet[index];
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_GetMemoryUsage<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return m_SparseSet.GetMemoryUsage();
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_ShrinkToFit<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_ShrinkToFit(Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr void Do() const
+        {
+            m_SparseSet.ShrinkToFit();
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_GetData<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_GetData(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr const ElementType* Do() const
+        {
+            return m_SparseSet.GetData();
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_EraseAtUnordered<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_EraseAtUnordered(Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            m_SparseSet.EraseAt(index);
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+
+    template <class T, class ElementType, std::size_t PageSize>
+    struct ContainerOp_FindByHandle<T, Containers::SparseSet<ElementType, PageSize>>
+    {
+        constexpr explicit ContainerOp_FindByHandle(const Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr explicit ContainerOp_FindByHandle(Containers::SparseSet<ElementType, PageSize>& sparseSet)
+            : m_SparseSet(sparseSet)
+        {
+        }
+
+        constexpr const ElementType* Do(const typename Containers::SparseSet<ElementType, PageSize>::IdType id) const
+        {
+            return std::as_const(m_SparseSet).Find(id);
+        }
+
+private:
+
+        T m_SparseSet;
+    };
+}
@@ -5,6 +5,7 @@
 #include <array>
 #include <CppUtils/Misc/TypeTraits.h>
 #include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
 
 #define STATIC_ASSERT_GETFRONT_OR_GETBACK_UNDEFINED_BEHAVIOR static_assert(Capacity > 0, "Calling front or back on zero-sized std::array would be undefined.");
 
@@ -150,6 +151,62 @@ private:
 
         T m_Arr {};
     };    
+
+    template <class T, class ElementType, std::size_t Capacity>
+    struct ContainerOp_GetMemoryUsage<T, std::array<ElementType, Capacity>>
+    {
+        consteval explicit ContainerOp_GetMemoryUsage(const std::array<ElementType, Capacity>&)
+        {
+        }
+
+        consteval ContainerMemoryUsage Do() const
+        {
+            return ContainerMemoryUsage{ .InlineBytes = sizeof(std::array<ElementType, Capacity>) };
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Capacity>
+    struct ContainerOp_ShrinkToFit<T, std::array<ElementType, Capacity>>
+    {
+        consteval explicit ContainerOp_ShrinkToFit(std::array<ElementType, Capacity>&)
+        {
+        }
+
+        consteval void Do() const
+        {
+            // Nothing to release, storage is inline.
+        }
+    };
+
+    template <class T, class ElementType, std::size_t Capacity>
+    struct ContainerOp_GetData<T, std::array<ElementType, Capacity>>
+    {
+        constexpr explicit ContainerOp_GetData(const std::array<ElementType, Capacity>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(std::array<ElementType, Capacity>& arr)
+            : m_Arr(arr)
+        {
+        }
+
+        constexpr const ElementType* Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr.data();
+        }
+
+        constexpr ElementType* Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Arr.data();
+        }
+
+private:
+
+        T m_Arr {};
+    };
 }
 
 #if !defined(STATIC_ASSERT_GETFRONT_OR_GETBACK_UNDEFINED_BEHAVIOR)
@@ -0,0 +1,90 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <version>
+
+#if defined(__cpp_lib_mdspan)
+
+#include <array>
+#include <mdspan>
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+
+/*
+* Only for the default accessor, whose references are plain element references like every other container's. Like the
+* mdspan itself, the layout decides where elements live.
+*
+* An mdspan is a view, so its own constness doesn't propagate to its elements. The ops do propagate it (a const mdspan
+* gives const elements), consistent with the rest of the container ops.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType, class ExtentsType, class LayoutPolicyType>
+    struct ContainerOp_GetSize<T, std::mdspan<ElementType, ExtentsType, LayoutPolicyType, std::default_accessor<ElementType>>>
+    {
+        constexpr explicit ContainerOp_GetSize(const std::mdspan<ElementType, ExtentsType, LayoutPolicyType, std::default_accessor<ElementType>>& mdspan)
+            : m_Mdspan(mdspan)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_Mdspan.size();
+        }
+
+private:
+
+        T m_Mdspan;
+    };
+
+    template <class T, class ElementType, class ExtentsType, class LayoutPolicyType>
+    struct ContainerOp_GetExtent<T, std::mdspan<ElementType, ExtentsType, LayoutPolicyType, std::default_accessor<ElementType>>>
+    {
+        constexpr explicit ContainerOp_GetExtent(const std::mdspan<ElementType, ExtentsType, LayoutPolicyType, std::default_accessor<ElementType>>& mdspan)
+            : m_Mdspan(mdspan)
+        {
+        }
+
+        constexpr std::size_t Do(const std::size_t dimension) const
+        {
+            return static_cast<std::size_t>(m_Mdspan.extent(static_cast<typename ExtentsType::rank_type>(dimension)));
+        }
+
+private:
+
+        T m_Mdspan;
+    };
+
+    template <class T, class ElementType, class ExtentsType, class LayoutPolicyType>
+    struct ContainerOp_GetElementND<T, std::mdspan<ElementType, ExtentsType, LayoutPolicyType, std::default_accessor<ElementType>>>
+    {
+        constexpr explicit ContainerOp_GetElementND(const std::mdspan<ElementType, ExtentsType, LayoutPolicyType, std::default_accessor<ElementType>>& mdspan)
+            : m_Mdspan(mdspan)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElementND(std::mdspan<ElementType, ExtentsType, LayoutPolicyType, std::default_accessor<ElementType>>& mdspan)
+            : m_Mdspan(mdspan)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::array<typename ExtentsType::index_type, ExtentsType::rank()>& index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Mdspan[index];
+        }
+
+        constexpr ElementType& Do(const std::array<typename ExtentsType::index_type, ExtentsType::rank()>& index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Mdspan[index];
+        }
+
+private:
+
+        T m_Mdspan;
+    };
+}
+
+#endif
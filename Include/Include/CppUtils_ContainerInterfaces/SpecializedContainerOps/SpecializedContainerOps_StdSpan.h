@@ -0,0 +1,286 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+
+/*
+* Spans are views, so their own constness doesn't propagate to their elements. The ops do propagate it (a const span
+* gives const elements), consistent with the rest of the container ops. Static extent spans answer size queries at
+* compile time, like `std::array`.
+*
+* Memory usage only counts the span itself, since it doesn't own its elements.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_GetCapacity<T, std::span<ElementType, Extent>>
+    {
+        consteval explicit ContainerOp_GetCapacity(const std::span<ElementType, Extent>&)
+        {
+        }
+
+        consteval std::size_t Do() const
+        {
+            return Extent;
+        }
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetCapacity<T, std::span<ElementType, std::dynamic_extent>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const std::span<ElementType, std::dynamic_extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_Span.size();
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_GetSize<T, std::span<ElementType, Extent>>
+    {
+        consteval explicit ContainerOp_GetSize(const std::span<ElementType, Extent>&)
+        {
+        }
+
+        consteval std::size_t Do() const
+        {
+            return Extent;
+        }
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetSize<T, std::span<ElementType, std::dynamic_extent>>
+    {
+        constexpr explicit ContainerOp_GetSize(const std::span<ElementType, std::dynamic_extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_Span.size();
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_IsValidIndex<T, std::span<ElementType, Extent>>
+    {
+        consteval explicit ContainerOp_IsValidIndex(const std::span<ElementType, Extent>&)
+        {
+        }
+
+        consteval bool Do(const std::size_t index) const
+        {
+            return index < Extent;
+        }
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsValidIndex<T, std::span<ElementType, std::dynamic_extent>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const std::span<ElementType, std::dynamic_extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_Span.size();
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_IsEmpty<T, std::span<ElementType, Extent>>
+    {
+        consteval explicit ContainerOp_IsEmpty(const std::span<ElementType, Extent>&)
+        {
+        }
+
+        consteval bool Do() const
+        {
+            return Extent == 0;
+        }
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_IsEmpty<T, std::span<ElementType, std::dynamic_extent>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const std::span<ElementType, std::dynamic_extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_Span.empty();
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_GetFront<T, std::span<ElementType, Extent>>
+    {
+        constexpr explicit ContainerOp_GetFront(const std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Span.front();
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Span.front();
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_GetBack<T, std::span<ElementType, Extent>>
+    {
+        constexpr explicit ContainerOp_GetBack(const std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr const ElementType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Span.back();
+        }
+
+        constexpr ElementType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Span.back();
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_GetElement<T, std::span<ElementType, Extent>>
+    {
+        constexpr explicit ContainerOp_GetElement(const std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Span[index];
+        }
+
+        constexpr ElementType& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Span[index];
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_GetMemoryUsage<T, std::span<ElementType, Extent>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return ContainerMemoryUsage
+            {
+                .HeapBytes = 0,
+                .InlineBytes = sizeof(m_Span),
+                .SlackBytes = 0,
+            };
+        }
+
+private:
+
+        T m_Span;
+    };
+
+    template <class T, class ElementType, std::size_t Extent>
+    struct ContainerOp_GetData<T, std::span<ElementType, Extent>>
+    {
+        constexpr explicit ContainerOp_GetData(const std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(std::span<ElementType, Extent>& span)
+            : m_Span(span)
+        {
+        }
+
+        constexpr const ElementType* Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Span.data();
+        }
+
+        constexpr ElementType* Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Span.data();
+        }
+
+private:
+
+        T m_Span;
+    };
+}
@@ -0,0 +1,319 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+
+/*
+* For any character traits and allocator. Capacity is the string's own, which includes the small string buffer, so short
+* strings report capacity without any allocation. Memory usage accounts for that too.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_GetCapacity<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_String.capacity();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_GetSize<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_String.size();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_IsValidIndex<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_String.size();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_IsEmpty<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_String.empty();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_GetFront<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_GetFront(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr const CharType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_String.front();
+        }
+
+        constexpr CharType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_String.front();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_GetBack<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_GetBack(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr const CharType& Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_String.back();
+        }
+
+        constexpr CharType& Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_String.back();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_GetElement<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr const CharType& Do(const std::size_t index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_String[index];
+        }
+
+        constexpr CharType& Do(const std::size_t index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_String[index];
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_GetMemoryUsage<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            // Short strings live in a buffer inside the string object (SSO), in which case nothing is allocated and the unused
+            // part of the buffer is already counted as inline. Heap buffers have room for the null terminator beyond the capacity.
+            const std::byte* const data = reinterpret_cast<const std::byte*>(m_String.data());
+            const std::byte* const object = reinterpret_cast<const std::byte*>(std::addressof(m_String));
+            const bool bIsInline = !std::less<>{}(data, object) && std::less<>{}(data, object + sizeof(m_String));
+
+            return ContainerMemoryUsage
+            {
+                .HeapBytes = bIsInline ? 0 : (m_String.capacity() + 1) * sizeof(CharType),
+                .InlineBytes = sizeof(m_String),
+                .SlackBytes = bIsInline ? 0 : (m_String.capacity() - m_String.size()) * sizeof(CharType),
+            };
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_ShrinkToFit<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_ShrinkToFit(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr void Do() const
+        {
+            m_String.shrink_to_fit();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_GetData<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_GetData(const std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr const CharType* Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_String.data();
+        }
+
+        constexpr CharType* Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_String.data();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_EraseAtUnordered<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_EraseAtUnordered(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            if (index != m_String.size() - 1)
+            {
+                m_String[index] = std::move(m_String.back());
+            }
+            m_String.pop_back();
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_EraseAtOrdered<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_EraseAtOrdered(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            m_String.erase(index, 1);
+        }
+
+private:
+
+        T m_String;
+    };
+
+    template <class T, class CharType, class TraitsType, class AllocatorType>
+    struct ContainerOp_Truncate<T, std::basic_string<CharType, TraitsType, AllocatorType>>
+    {
+        constexpr explicit ContainerOp_Truncate(std::basic_string<CharType, TraitsType, AllocatorType>& string)
+            : m_String(string)
+        {
+        }
+
+        constexpr void Do(const std::size_t size) const
+        {
+            if (size < m_String.size())
+            {
+                m_String.erase(size);
+            }
+        }
+
+private:
+
+        T m_String;
+    };
+}
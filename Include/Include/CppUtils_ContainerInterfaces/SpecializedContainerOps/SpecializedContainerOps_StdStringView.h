@@ -0,0 +1,204 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+
+/*
+* String views are read-only, so elements are const even through non-const views. A view's capacity is its size.
+*
+* Memory usage only counts the view itself, since it doesn't own its characters.
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_GetCapacity<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_GetCapacity(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_StringView.size();
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_GetSize<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_StringView.size();
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_IsValidIndex<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_IsValidIndex(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr bool Do(const std::size_t index) const
+        {
+            return index < m_StringView.size();
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_IsEmpty<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_IsEmpty(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr bool Do() const
+        {
+            return m_StringView.empty();
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_GetFront<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_GetFront(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetFront(std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr const CharType& Do() const
+        {
+            return m_StringView.front();
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_GetBack<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_GetBack(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetBack(std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr const CharType& Do() const
+        {
+            return m_StringView.back();
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_GetElement<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_GetElement(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElement(std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr const CharType& Do(const std::size_t index) const
+        {
+            return m_StringView[index];
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_GetMemoryUsage<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return ContainerMemoryUsage
+            {
+                .HeapBytes = 0,
+                .InlineBytes = sizeof(m_StringView),
+                .SlackBytes = 0,
+            };
+        }
+
+private:
+
+        T m_StringView;
+    };
+
+    template <class T, class CharType, class TraitsType>
+    struct ContainerOp_GetData<T, std::basic_string_view<CharType, TraitsType>>
+    {
+        constexpr explicit ContainerOp_GetData(const std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(std::basic_string_view<CharType, TraitsType>& stringView)
+            : m_StringView(stringView)
+        {
+        }
+
+        constexpr const CharType* Do() const
+        {
+            return m_StringView.data();
+        }
+
+private:
+
+        T m_StringView;
+    };
+}
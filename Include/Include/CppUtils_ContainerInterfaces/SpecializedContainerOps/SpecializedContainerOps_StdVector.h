@@ -2,9 +2,11 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 #include <CppUtils/Misc/TypeTraits.h>
 #include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
 
 namespace CppUtils::ContainerOps::Detail
 {
@@ -161,6 +163,140 @@ private:
             return m_Vector[index];
         }
 
+private:
+
+        T m_Vector;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetMemoryUsage<T, std::vector<ElementType, std::allocator<ElementType>>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const std::vector<ElementType, std::allocator<ElementType>>& vector)
+            : m_Vector(vector)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return ContainerMemoryUsage
+            {
+                .HeapBytes = m_Vector.capacity() * sizeof(ElementType),
+                .InlineBytes = sizeof(m_Vector),
+                .SlackBytes = (m_Vector.capacity() - m_Vector.size()) * sizeof(ElementType),
+            };
+        }
+
+private:
+
+        T m_Vector;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_ShrinkToFit<T, std::vector<ElementType, std::allocator<ElementType>>>
+    {
+        constexpr explicit ContainerOp_ShrinkToFit(std::vector<ElementType, std::allocator<ElementType>>& vector)
+            : m_Vector(vector)
+        {
+        }
+
+        constexpr void Do() const
+        {
+            m_Vector.shrink_to_fit();
+        }
+
+private:
+
+        T m_Vector;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_GetData<T, std::vector<ElementType, std::allocator<ElementType>>>
+    {
+        constexpr explicit ContainerOp_GetData(const std::vector<ElementType, std::allocator<ElementType>>& vector)
+            : m_Vector(vector)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetData(std::vector<ElementType, std::allocator<ElementType>>& vector)
+            : m_Vector(vector)
+        {
+        }
+
+        constexpr const ElementType* Do() const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Vector.data();
+        }
+
+        constexpr ElementType* Do() const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Vector.data();
+        }
+
+private:
+
+        T m_Vector;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_EraseAtUnordered<T, std::vector<ElementType, std::allocator<ElementType>>>
+    {
+        constexpr explicit ContainerOp_EraseAtUnordered(std::vector<ElementType, std::allocator<ElementType>>& vector)
+            : m_Vector(vector)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            ElementType& back = m_Vector.back();
+            if (&m_Vector[index] != &back)
+            {
+                m_Vector[index] = std::move(back);
+            }
+            m_Vector.pop_back();
+        }
+
+private:
+
+        T m_Vector;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_EraseAtOrdered<T, std::vector<ElementType, std::allocator<ElementType>>>
+    {
+        constexpr explicit ContainerOp_EraseAtOrdered(std::vector<ElementType, std::allocator<ElementType>>& vector)
+            : m_Vector(vector)
+        {
+        }
+
+        constexpr void Do(const std::size_t index) const
+        {
+            m_Vector.erase(m_Vector.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+
+private:
+
+        T m_Vector;
+    };
+
+    template <class T, class ElementType>
+    struct ContainerOp_Truncate<T, std::vector<ElementType, std::allocator<ElementType>>>
+    {
+        constexpr explicit ContainerOp_Truncate(std::vector<ElementType, std::allocator<ElementType>>& vector)
+            : m_Vector(vector)
+        {
+        }
+
+        constexpr void Do(const std::size_t size) const
+        {
+            // Not `resize`, which would require the elements to be default constructible.
+            if (size < m_Vector.size())
+            {
+                m_Vector.erase(m_Vector.begin() + static_cast<std::ptrdiff_t>(size), m_Vector.end());
+            }
+        }
+
 private:
 
         T m_Vector;
@@ -0,0 +1,100 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#pragma once
+
+#include <array>
+#include <CppUtils/Misc/TypeTraits.h>
+#include <CppUtils_ContainerInterfaces/ContainerOps_PrimaryTemplate.h>
+#include <CppUtils_ContainerInterfaces/ContainerMemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/Containers/Tensor.h>
+
+/*
+* Tensors implement the multidimensional ops. They don't implement `GetElement` or `GetData`, since positions in storage
+* aren't positions in the tensor for every layout (e.g. tiled storage is padded).
+*/
+namespace CppUtils::ContainerOps::Detail
+{
+    template <class T, class ElementType, std::size_t Rank, class LayoutType>
+    struct ContainerOp_GetSize<T, Containers::Tensor<ElementType, Rank, LayoutType>>
+    {
+        constexpr explicit ContainerOp_GetSize(const Containers::Tensor<ElementType, Rank, LayoutType>& tensor)
+            : m_Tensor(tensor)
+        {
+        }
+
+        constexpr std::size_t Do() const
+        {
+            return m_Tensor.GetSize();
+        }
+
+private:
+
+        T m_Tensor;
+    };
+
+    template <class T, class ElementType, std::size_t Rank, class LayoutType>
+    struct ContainerOp_GetExtent<T, Containers::Tensor<ElementType, Rank, LayoutType>>
+    {
+        constexpr explicit ContainerOp_GetExtent(const Containers::Tensor<ElementType, Rank, LayoutType>& tensor)
+            : m_Tensor(tensor)
+        {
+        }
+
+        constexpr std::size_t Do(const std::size_t dimension) const
+        {
+            return m_Tensor.GetExtent(dimension);
+        }
+
+private:
+
+        T m_Tensor;
+    };
+
+    template <class T, class ElementType, std::size_t Rank, class LayoutType>
+    struct ContainerOp_GetElementND<T, Containers::Tensor<ElementType, Rank, LayoutType>>
+    {
+        constexpr explicit ContainerOp_GetElementND(const Containers::Tensor<ElementType, Rank, LayoutType>& tensor)
+            : m_Tensor(tensor)
+        {
+        }
+
+        constexpr explicit ContainerOp_GetElementND(Containers::Tensor<ElementType, Rank, LayoutType>& tensor)
+            : m_Tensor(tensor)
+        {
+        }
+
+        constexpr const ElementType& Do(const std::array<std::size_t, Rank>& index) const
+            requires (IsConstAfterRemovingRef<T>())
+        {
+            return m_Tensor[index];
+        }
+
+        constexpr ElementType& Do(const std::array<std::size_t, Rank>& index) const
+            requires (!IsConstAfterRemovingRef<T>())
+        {
+            return m_Tensor[index];
+        }
+
+private:
+
+        T m_Tensor;
+    };
+
+    template <class T, class ElementType, std::size_t Rank, class LayoutType>
+    struct ContainerOp_GetMemoryUsage<T, Containers::Tensor<ElementType, Rank, LayoutType>>
+    {
+        constexpr explicit ContainerOp_GetMemoryUsage(const Containers::Tensor<ElementType, Rank, LayoutType>& tensor)
+            : m_Tensor(tensor)
+        {
+        }
+
+        constexpr ContainerMemoryUsage Do() const
+        {
+            return m_Tensor.GetMemoryUsage();
+        }
+
+private:
+
+        T m_Tensor;
+    };
+}
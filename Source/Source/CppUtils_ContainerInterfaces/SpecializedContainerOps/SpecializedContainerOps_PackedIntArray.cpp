@@ -0,0 +1,3 @@
+// Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
+
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_PackedIntArray.h>
@@ -1,12 +1,47 @@
 // Copyright (c) 2023-2025 Christian Hinkle, Brian Hinkle.
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 #include <cassert>
 #include <CppUtils_ContainerInterfaces/ContainerOps.h>
+#include <CppUtils_ContainerInterfaces/ContainerOpIterator.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_MemoryUsage.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Compaction.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_BulkCopy.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Compare.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Hash.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Sort.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Find.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Erase.h>
+#include <CppUtils_ContainerInterfaces/ContainerAlgorithms/ContainerAlgorithms_Stream.h>
 #include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_RawArray.h>
 #include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_StdArray.h>
 #include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_StdVector.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_SlotMap.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_SparseSet.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_SnapshotVector.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_PaddedArray.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_PerThreadArray.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_ContainerViews.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_Tensor.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_StdMdspan.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_StdSpan.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_StdString.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_StdStringView.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_PackedIntArray.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_SegmentedVector.h>
+#include <CppUtils_ContainerInterfaces/SpecializedContainerOps/SpecializedContainerOps_DaryHeap.h>
 
 template <class ContainerType>
 bool DoesPassOperationChecks(const ContainerType& container)
@@ -61,6 +96,1137 @@ bool DoesPassOperationChecks(const ContainerType& container)
     return true;
 }
 
+bool DoesPassMemoryUsageChecks()
+{
+    std::vector<std::vector<int>> nestedVector(2);
+    nestedVector.reserve(4);
+    nestedVector[0].reserve(8);
+    nestedVector[1].resize(2);
+    nestedVector[1].shrink_to_fit();
+
+    const CppUtils::ContainerOps::ContainerMemoryUsage shallowUsage = CppUtils::ContainerOps::GetMemoryUsage{nestedVector}.Do();
+    if (shallowUsage.HeapBytes != 4 * sizeof(std::vector<int>) || shallowUsage.SlackBytes != 2 * sizeof(std::vector<int>))
+    {
+        return false;
+    }
+
+    const CppUtils::ContainerOps::ContainerMemoryUsage recursiveUsage = CppUtils::ContainerAlgorithms::GetMemoryUsageRecursive(nestedVector);
+    if (recursiveUsage.HeapBytes != shallowUsage.HeapBytes + 10 * sizeof(int) || recursiveUsage.SlackBytes != shallowUsage.SlackBytes + 8 * sizeof(int))
+    {
+        return false;
+    }
+
+    std::array<int, 3> stdArray {};
+    if (CppUtils::ContainerOps::GetMemoryUsage{stdArray}.Do().InlineBytes != sizeof(stdArray))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassCompactionChecks()
+{
+    std::vector<int> burstVector(16);
+    burstVector.reserve(64 * 1024);
+    std::vector<int> tightVector(16);
+    std::vector<int> secondBurstVector(16);
+    secondBurstVector.reserve(64 * 1024);
+
+    CppUtils::ContainerAlgorithms::CompactionSettings settings;
+    settings.CopyBudgetBytes = 16 * sizeof(int); // Room for shrinking a single burst vector per run.
+    CppUtils::ContainerAlgorithms::CompactionPolicy compactionPolicy(settings);
+    compactionPolicy.Register(burstVector);
+    compactionPolicy.Register(tightVector);
+    compactionPolicy.Register(secondBurstVector);
+
+    const CppUtils::ContainerAlgorithms::CompactionRunResult firstResult = compactionPolicy.Run();
+    if (firstResult.ContainersShrunk != 1 || firstResult.bCompletedPass || burstVector.capacity() != 16 || secondBurstVector.capacity() == 16)
+    {
+        return false;
+    }
+
+    const CppUtils::ContainerAlgorithms::CompactionRunResult secondResult = compactionPolicy.Run();
+    if (secondResult.ContainersShrunk != 1 || !secondResult.bCompletedPass || secondBurstVector.capacity() != 16)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassBulkCopyChecks()
+{
+    // Bitwise paths.
+    {
+        const std::array<int, 3> stdArray { 1, 2, 3 };
+        int rawArr[4]                     { 0, 0, 0, 0 };
+        std::vector<int> stdVector(2);
+
+        if (CppUtils::ContainerAlgorithms::CopyInto(rawArr, stdArray) != 3 || rawArr[2] != 3 || rawArr[3] != 0)
+        {
+            return false;
+        }
+
+        if (CppUtils::ContainerAlgorithms::MoveInto(stdVector, rawArr) != 2 || stdVector != std::vector<int>{ 1, 2 })
+        {
+            return false;
+        }
+
+        CppUtils::ContainerAlgorithms::Fill(rawArr, 7);
+        if (rawArr[0] != 7 || rawArr[3] != 7)
+        {
+            return false;
+        }
+    }
+
+    // Overlapping views of the same buffer.
+    {
+        int rawArr[5] { 1, 2, 3, 4, 5 };
+        std::span<int> dst(rawArr + 1, 4);
+        const std::span<const int> src(rawArr, 4);
+
+        if (CppUtils::ContainerAlgorithms::CopyInto(dst, src) != 4 || rawArr[1] != 1 || rawArr[4] != 4)
+        {
+            return false;
+        }
+    }
+
+    // Element-wise paths.
+    {
+        const std::vector<std::string> source { "a", "b" };
+        std::array<std::string, 2> destination;
+
+        CppUtils::ContainerAlgorithms::CopyInto(destination, source);
+        CppUtils::ContainerAlgorithms::Fill(destination, "c");
+        if (destination[1] != "c" || source[1] != "b")
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DoesPassCompareAndHashChecks()
+{
+    const std::array<int, 3> stdArray { 1, 2, 3 };
+    const std::vector<int> stdVector  { 1, 2, 3 };
+    const std::vector<int> longerVector { 1, 2, 3, 0 };
+
+    if (!CppUtils::ContainerAlgorithms::Equal(stdArray, stdVector) || CppUtils::ContainerAlgorithms::Equal(stdVector, longerVector))
+    {
+        return false;
+    }
+
+    if (CppUtils::ContainerAlgorithms::Compare(stdVector, longerVector) >= 0 || CppUtils::ContainerAlgorithms::Compare(stdArray, stdVector) != 0)
+    {
+        return false;
+    }
+
+    const std::vector<unsigned char> lowBytes { 1, 200 };
+    const std::vector<unsigned char> highBytes { 1, 201 };
+    if (CppUtils::ContainerAlgorithms::Compare(highBytes, lowBytes) <= 0)
+    {
+        return false;
+    }
+
+    if (CppUtils::ContainerAlgorithms::Hash(stdArray) != CppUtils::ContainerAlgorithms::Hash(stdVector)
+        || CppUtils::ContainerAlgorithms::Hash(stdVector) == CppUtils::ContainerAlgorithms::Hash(longerVector))
+    {
+        return false;
+    }
+
+    const std::vector<std::string> strings { "a", "b" };
+    const std::vector<std::string> otherStrings { "a", "c" };
+    if (CppUtils::ContainerAlgorithms::Hash(strings) == CppUtils::ContainerAlgorithms::Hash(otherStrings) || !CppUtils::ContainerAlgorithms::Equal(strings, strings))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassSortChecks()
+{
+    // Enough elements for the radix and parallel paths.
+    std::vector<int> ids(CppUtils::ContainerAlgorithms::ParallelSortThreshold + 3);
+    unsigned int state = 1;
+    for (int& id : ids)
+    {
+        state = state * 1664525u + 1013904223u;
+        id = static_cast<int>(state);
+    }
+    CppUtils::ContainerAlgorithms::Sort(ids);
+    if (!std::is_sorted(ids.begin(), ids.end()))
+    {
+        return false;
+    }
+
+    std::vector<double> keys(1000);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = (static_cast<double>(i * 7919 % 1000) - 500.0) * 0.25;
+    }
+    CppUtils::ContainerAlgorithms::Sort(keys);
+    if (!std::is_sorted(keys.begin(), keys.end()))
+    {
+        return false;
+    }
+
+    std::vector<std::string> strings { "d", "a", "c", "b" };
+    CppUtils::ContainerAlgorithms::Sort(strings, std::greater<>{});
+    if (strings != std::vector<std::string> { "d", "c", "b", "a" })
+    {
+        return false;
+    }
+
+    // Stable sort by the high digit only.
+    std::array<int, 6> stdArray { 31, 12, 33, 14, 35, 16 };
+    CppUtils::ContainerAlgorithms::StableSort(stdArray, [](const int lhs, const int rhs) { return lhs / 10 < rhs / 10; });
+    if (stdArray != std::array<int, 6> { 12, 14, 16, 31, 33, 35 })
+    {
+        return false;
+    }
+
+    const CppUtils::ContainerOps::ContainerOpIterator first(stdArray, 0);
+    const CppUtils::ContainerOps::ContainerOpIterator last(stdArray, stdArray.size());
+    if (last - first != 6 || *(first + 2) != 16 || !std::is_sorted(first, last))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassFindChecks()
+{
+    // Long enough for the vectorized loops, with the match in the scalar tail.
+    std::vector<std::uint16_t> ids(203, 7);
+    ids[201] = 9;
+    ids[202] = 9;
+    if (CppUtils::ContainerAlgorithms::FindValue(ids, 9) != 201 || CppUtils::ContainerAlgorithms::CountValue(ids, 7) != 201)
+    {
+        return false;
+    }
+
+    // Not representable as an element, so it can't match even though it truncates to 7.
+    if (CppUtils::ContainerAlgorithms::ContainsValue(ids, 65543) || CppUtils::ContainerAlgorithms::CountValue(ids, -1) != 0)
+    {
+        return false;
+    }
+
+    const std::array<std::int64_t, 5> stdArray { 1, -2, 3, -2, 5 };
+    if (CppUtils::ContainerAlgorithms::FindValue(stdArray, -2) != 1 || CppUtils::ContainerAlgorithms::CountValue(stdArray, -2) != 2)
+    {
+        return false;
+    }
+
+    const std::vector<std::string> strings { "a", "b" };
+    if (!CppUtils::ContainerAlgorithms::ContainsValue(strings, "b") || CppUtils::ContainerAlgorithms::FindValue(strings, "c").has_value())
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassEraseChecks()
+{
+    std::vector<int> stdVector { 0, 1, 2, 3, 4 };
+    CppUtils::ContainerOps::EraseAtUnordered{stdVector}.Do(1);
+    CppUtils::ContainerOps::EraseAtOrdered{stdVector}.Do(0);
+    if (stdVector != std::vector<int> { 4, 2, 3 })
+    {
+        return false;
+    }
+
+    CppUtils::ContainerOps::Truncate{stdVector}.Do(1);
+    CppUtils::ContainerOps::Truncate{stdVector}.Do(5);
+    if (stdVector != std::vector<int> { 4 })
+    {
+        return false;
+    }
+
+    // Enough elements for whole compaction blocks and a partial one.
+    std::vector<std::uint64_t> ids(150);
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        ids[i] = i;
+    }
+    if (CppUtils::ContainerAlgorithms::EraseIf(ids, [](const std::uint64_t id) { return id % 3 != 0; }) != 100 || ids.size() != 50)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+        if (ids[i] != i * 3)
+        {
+            return false;
+        }
+    }
+
+    std::vector<std::string> strings { "a", "b", "a", "c" };
+    if (CppUtils::ContainerAlgorithms::EraseIf(strings, [](const std::string& string) { return string == "a"; }) != 2
+        || strings != std::vector<std::string> { "b", "c" })
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassSlotMapChecks()
+{
+    CppUtils::Containers::SlotMap<std::string> slotMap;
+    const CppUtils::Containers::SlotMapHandle a = slotMap.Insert("a");
+    const CppUtils::Containers::SlotMapHandle b = slotMap.Insert("b");
+    const CppUtils::Containers::SlotMapHandle c = slotMap.Insert("c");
+
+    // Erasing moves the back element into the hole, without invalidating its handle.
+    if (!slotMap.Erase(a) || slotMap.Erase(a) || CppUtils::ContainerOps::FindByHandle{slotMap}.Do(a) != nullptr)
+    {
+        return false;
+    }
+    if (CppUtils::ContainerOps::GetFront{slotMap}.Do() != "c" || *CppUtils::ContainerOps::FindByHandle{slotMap}.Do(c) != "c")
+    {
+        return false;
+    }
+
+    // The erased slot is reused, but the stale handle still doesn't match.
+    const CppUtils::Containers::SlotMapHandle d = slotMap.Insert("d");
+    if (d.Index != a.Index || slotMap.Contains(a) || *slotMap.Find(d) != "d")
+    {
+        return false;
+    }
+
+    CppUtils::ContainerOps::EraseAtUnordered{slotMap}.Do(0);
+    if (slotMap.Contains(c) || CppUtils::ContainerOps::GetSize{slotMap}.Do() != 2 || *slotMap.Find(b) != "b" || *slotMap.Find(d) != "d")
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < slotMap.GetSize(); ++i)
+    {
+        if (slotMap.Find(slotMap.GetHandle(i)) != &slotMap[i])
+        {
+            return false;
+        }
+    }
+
+    // A throwing element ctor keeps the free slot for the next insert.
+    bool bThrew = false;
+    try
+    {
+        slotMap.Emplace(std::string::npos, 'x');
+    }
+    catch (const std::length_error&)
+    {
+        bThrew = true;
+    }
+    const CppUtils::Containers::SlotMapHandle e = slotMap.Insert("e");
+    return bThrew && e.Index == c.Index && slotMap.GetSize() == 3 && slotMap.Find(slotMap.GetHandle(2)) == &slotMap[2];
+}
+
+bool DoesPassSparseSetChecks()
+{
+    CppUtils::Containers::SparseSet<std::string> sparseSet;
+    sparseSet.Insert(3, "a");
+    sparseSet.Insert(100000, "b");
+    sparseSet.Insert(7, "c");
+    sparseSet.Insert(3, "d"); // Replaces.
+
+    if (sparseSet.GetSize() != 3 || !sparseSet.Contains(100000) || sparseSet.Contains(4) || sparseSet.Contains(200000))
+    {
+        return false;
+    }
+
+    if (*CppUtils::ContainerOps::FindByHandle{sparseSet}.Do(3) != "d" || CppUtils::ContainerOps::FindByHandle{sparseSet}.Do(5) != nullptr)
+    {
+        return false;
+    }
+
+    // Positional access is read-only, so generic code can't reorder elements behind the id mapping.
+    static_assert(std::is_same_v<decltype(CppUtils::ContainerOps::GetElement{sparseSet}.Do(0)), const std::string&>);
+    static_assert(std::is_same_v<decltype(CppUtils::ContainerOps::GetData{sparseSet}.Do()), const std::string*>);
+    if (CppUtils::ContainerOps::GetElement{sparseSet}.Do(1) != "b" || CppUtils::ContainerOps::GetBack{sparseSet}.Do() != "c"
+        || CppUtils::ContainerOps::GetData{sparseSet}.Do() != sparseSet.Find(3))
+    {
+        return false;
+    }
+
+    // Erasing moves the back element into the hole.
+    if (!sparseSet.Erase(3) || sparseSet.Erase(3) || CppUtils::ContainerOps::GetFront{sparseSet}.Do() != "c" || *sparseSet.Find(7) != "c")
+    {
+        return false;
+    }
+
+    // The page of id 100000 is released once it's unused.
+    const std::size_t heapBytes = CppUtils::ContainerOps::GetMemoryUsage{sparseSet}.Do().HeapBytes;
+    CppUtils::ContainerOps::EraseAtUnordered{sparseSet}.Do(1);
+    CppUtils::ContainerOps::ShrinkToFit{sparseSet}.Do();
+    if (sparseSet.Contains(100000) || CppUtils::ContainerOps::GetMemoryUsage{sparseSet}.Do().HeapBytes >= heapBytes || *sparseSet.Find(7) != "c")
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassSnapshotVectorChecks()
+{
+    using SnapshotType = CppUtils::Containers::SnapshotVector<int>::Snapshot;
+
+    CppUtils::Containers::SnapshotVector<int> snapshotVector(std::vector<int>{ 1, 2, 3 });
+
+    {
+        const SnapshotType oldSnapshot = snapshotVector.GetSnapshot();
+        snapshotVector.Update([](std::vector<int>& elements) { elements.push_back(4); });
+
+        // The old snapshot keeps seeing its version, and keeps it from being reclaimed.
+        if (CppUtils::ContainerOps::GetSize{oldSnapshot}.Do() != 3 || CppUtils::ContainerOps::GetBack{oldSnapshot}.Do() != 3)
+        {
+            return false;
+        }
+
+        if (snapshotVector.ReclaimRetired() != 0 || snapshotVector.GetRetiredCount() != 1)
+        {
+            return false;
+        }
+
+        const SnapshotType newSnapshot = snapshotVector.GetSnapshot();
+        if (CppUtils::ContainerOps::GetSize{newSnapshot}.Do() != 4 || CppUtils::ContainerOps::GetElement{newSnapshot}.Do(3) != 4
+            || CppUtils::ContainerOps::GetFront{newSnapshot}.Do() != 1)
+        {
+            return false;
+        }
+    }
+
+    if (snapshotVector.ReclaimRetired() != 1 || snapshotVector.GetRetiredCount() != 0)
+    {
+        return false;
+    }
+
+    snapshotVector.Publish({});
+    const SnapshotType emptySnapshot = snapshotVector.GetSnapshot();
+    if (!CppUtils::ContainerOps::IsEmpty{emptySnapshot}.Do() || CppUtils::ContainerOps::IsValidIndex{emptySnapshot}.Do(0))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool DoesPassPerThreadArrayChecks()
+{
+    // Each worker increments its own element, then the elements are reduced through the generic ops.
+    CppUtils::Containers::PaddedArray<std::uint64_t, 4> workerCounters;
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t worker = 0; worker < 4; ++worker)
+        {
+            workers.emplace_back([&workerCounters, worker]
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    ++workerCounters[worker];
+                }
+            });
+        }
+    }
+
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < CppUtils::ContainerOps::GetSize{workerCounters}.Do(); ++i)
+    {
+        total += CppUtils::ContainerOps::GetElement{workerCounters}.Do(i);
+    }
+    if (total != 4000 || reinterpret_cast<std::uintptr_t>(&workerCounters[1]) - reinterpret_cast<std::uintptr_t>(&workerCounters[0]) < 64)
+    {
+        return false;
+    }
+
+    // More threads than elements share elements, so these need to be atomic.
+    CppUtils::Containers::PerThreadArray<std::atomic<std::uint64_t>> threadCounters(2);
+    {
+        std::vector<std::jthread> threads;
+        for (int thread = 0; thread < 5; ++thread)
+        {
+            threads.emplace_back([&threadCounters]
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    threadCounters.GetLocal().fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+    }
+
+    total = 0;
+    for (const std::atomic<std::uint64_t>& counter : threadCounters)
+    {
+        total += counter.load(std::memory_order_relaxed);
+    }
+
+    if (total != 5000 || CppUtils::ContainerOps::GetMemoryUsage{threadCounters}.Do().HeapBytes < 2 * 64)
+    {
+        return false;
+    }
+
+    // A size of zero gets one element, so threads always have one to use.
+    CppUtils::Containers::PerThreadArray<int> zeroSizedArray(0);
+    zeroSizedArray.GetLocal() = 1;
+    return zeroSizedArray.GetSize() == 1 && !CppUtils::ContainerOps::IsEmpty{zeroSizedArray}.Do() && zeroSizedArray[0] == 1;
+}
+
+bool DoesPassContainerViewChecks()
+{
+    struct Record
+    {
+        int Id;
+        std::string Name;
+    };
+
+    std::vector<Record> records { { 5, "e" }, { 1, "a" }, { 4, "d" }, { 2, "b" }, { 3, "c" } };
+
+    // Projections are writable through the view.
+    CppUtils::ContainerViews::TransformView ids(records, [](Record& record) -> int& { return record.Id; });
+    CppUtils::ContainerOps::GetElement{ids}.Do(0) = 6;
+    if (records[0].Id != 6 || CppUtils::ContainerOps::GetSize{ids}.Do() != 5 || !CppUtils::ContainerAlgorithms::ContainsValue(ids, 4))
+    {
+        return false;
+    }
+
+    // Sorting every other element in place.
+    std::vector<int> interleaved { 9, 0, 7, 0, 8, 0 };
+    CppUtils::ContainerViews::StrideView evens(interleaved, 2);
+    CppUtils::ContainerAlgorithms::Sort(evens);
+    if (interleaved != std::vector<int>{ 7, 0, 8, 0, 9, 0 } || CppUtils::ContainerOps::GetSize{evens}.Do() != 3 || CppUtils::ContainerOps::IsValidIndex{evens}.Do(3))
+    {
+        return false;
+    }
+
+    // A zero stride is treated as one.
+    const CppUtils::ContainerViews::StrideView all(interleaved, 0);
+    if (CppUtils::ContainerOps::GetSize{all}.Do() != interleaved.size() || all[4] != 9)
+    {
+        return false;
+    }
+
+    // Slices of contiguous containers are contiguous.
+    const std::vector<int> values { 0, 1, 2, 3, 4, 5 };
+    const CppUtils::ContainerViews::SliceView middle(values, 2, 3);
+    static_assert(CppUtils::ContainerAlgorithms::Detail::IsContiguousContainer<decltype(middle)>);
+    static_assert(!CppUtils::ContainerAlgorithms::Detail::IsContiguousContainer<decltype(evens)>);
+    if (CppUtils::ContainerOps::GetData{middle}.Do() != values.data() + 2 || CppUtils::ContainerAlgorithms::FindValue(middle, 4) != 2)
+    {
+        return false;
+    }
+
+    // Filtering, with and without the cached index, and over another view.
+    CppUtils::ContainerViews::FilterView evenValues(middle, [](const int value) { return value % 2 == 0; });
+    for (const bool bCacheIndex : { false, true })
+    {
+        if (bCacheIndex)
+        {
+            evenValues.CacheIndex();
+        }
+
+        if (CppUtils::ContainerOps::GetSize{evenValues}.Do() != 2 || CppUtils::ContainerOps::GetElement{evenValues}.Do(1) != 4
+            || CppUtils::ContainerOps::IsEmpty{evenValues}.Do())
+        {
+            return false;
+        }
+    }
+
+    int sum = 0;
+    for (const int value : evenValues)
+    {
+        sum += value;
+    }
+
+    return sum == 6;
+}
+
+bool DoesPassConcatViewChecks()
+{
+    std::array<int, 2> header { 1, 2 };
+    std::vector<int> body { 3, 4, 5 };
+    const std::vector<int> trailer { 6 };
+    std::vector<int> empty;
+
+    CppUtils::ContainerViews::ConcatView message(header, empty, body, trailer);
+    static_assert(std::is_const_v<decltype(message)::element_type>);
+
+    if (CppUtils::ContainerOps::GetSize{message}.Do() != 6 || CppUtils::ContainerOps::GetElement{message}.Do(2) != 3
+        || CppUtils::ContainerOps::GetElement{message}.Do(5) != 6 || CppUtils::ContainerOps::IsValidIndex{message}.Do(6))
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        if (message[i] != static_cast<int>(i) + 1)
+        {
+            return false;
+        }
+    }
+
+    // Segments are recorded on construction, and refreshed on request.
+    body.push_back(0);
+    message.Refresh();
+    if (CppUtils::ContainerOps::GetSize{message}.Do() != 7 || message[5] != 0 || message.GetSegment(6) != 3)
+    {
+        return false;
+    }
+
+    // Each segment takes the contiguous search path.
+    std::size_t countOfZero = 0;
+    message.ForEachSegment([&countOfZero](const auto& segment) { countOfZero += CppUtils::ContainerAlgorithms::CountValue(segment, 0); });
+
+    return countOfZero == 1 && CppUtils::ContainerAlgorithms::FindValue(message, 6) == 6;
+}
+
+/*
+* Written once against the multidimensional ops. Sums each element's 3x3 neighborhood (clamped at the edges) into `dst`.
+*/
+template <class DstGridType, class SrcGridType>
+void BoxSum(DstGridType& dst, const SrcGridType& src)
+{
+    const std::size_t rowCount = CppUtils::ContainerOps::GetExtent{src}.Do(0);
+    const std::size_t columnCount = CppUtils::ContainerOps::GetExtent{src}.Do(1);
+    for (std::size_t row = 0; row < rowCount; ++row)
+    {
+        for (std::size_t column = 0; column < columnCount; ++column)
+        {
+            int sum = 0;
+            for (std::size_t neighborRow = (row == 0 ? 0 : row - 1); neighborRow <= std::min(row + 1, rowCount - 1); ++neighborRow)
+            {
+                for (std::size_t neighborColumn = (column == 0 ? 0 : column - 1); neighborColumn <= std::min(column + 1, columnCount - 1); ++neighborColumn)
+                {
+                    sum += CppUtils::ContainerOps::GetElementND{src}.Do({ neighborRow, neighborColumn });
+                }
+            }
+            CppUtils::ContainerOps::GetElementND{dst}.Do({ row, column }) = sum;
+        }
+    }
+}
+
+template <class LayoutType>
+CppUtils::Containers::Tensor<int, 2> BoxSumWithLayout(const std::size_t rowCount, const std::size_t columnCount)
+{
+    CppUtils::Containers::Tensor<int, 2, LayoutType> src({ rowCount, columnCount });
+    for (std::size_t row = 0; row < rowCount; ++row)
+    {
+        for (std::size_t column = 0; column < columnCount; ++column)
+        {
+            src(row, column) = static_cast<int>(row * columnCount + column);
+        }
+    }
+
+    CppUtils::Containers::Tensor<int, 2> dst({ rowCount, columnCount });
+    BoxSum(dst, src);
+    return dst;
+}
+
+bool DoesPassTensorChecks()
+{
+    // Same results for every layout, including tiles that don't divide the extents.
+    const CppUtils::Containers::Tensor<int, 2> rowMajor = BoxSumWithLayout<CppUtils::Containers::LayoutRowMajor>(7, 5);
+    const CppUtils::Containers::Tensor<int, 2> columnMajor = BoxSumWithLayout<CppUtils::Containers::LayoutColumnMajor>(7, 5);
+    const CppUtils::Containers::Tensor<int, 2> tiled = BoxSumWithLayout<CppUtils::Containers::LayoutTiled<4>>(7, 5);
+    if (!std::equal(rowMajor.begin(), rowMajor.end(), columnMajor.begin()) || !std::equal(rowMajor.begin(), rowMajor.end(), tiled.begin()))
+    {
+        return false;
+    }
+
+    // Corner (0, 0) sums 0, 1, 5 and 6.
+    if (rowMajor(0, 0) != 12 || CppUtils::ContainerOps::GetSize{rowMajor}.Do() != 35)
+    {
+        return false;
+    }
+
+    // Tiles are padded to whole tiles, and consecutive within a tile.
+    const CppUtils::Containers::Tensor<int, 2, CppUtils::Containers::LayoutTiled<4>> tiledTensor({ 7, 5 });
+    const CppUtils::Containers::Tensor<int, 2, CppUtils::Containers::LayoutColumnMajor> columnMajorTensor({ 7, 5 });
+    if (tiledTensor.GetStorageSize() != 64 || &tiledTensor(1, 0) - &tiledTensor(0, 0) != 4 || &tiledTensor(0, 4) - &tiledTensor(0, 0) != 16
+        || &columnMajorTensor(1, 0) - &columnMajorTensor(0, 0) != 1)
+    {
+        return false;
+    }
+
+    return CppUtils::ContainerOps::GetMemoryUsage{tiledTensor}.Do().SlackBytes == (64 - 35) * sizeof(int);
+}
+
+bool DoesPassStringChecks()
+{
+    // Short strings are stored inline, so they don't allocate.
+    std::string shortString = "abc";
+    const CppUtils::ContainerOps::ContainerMemoryUsage shortUsage = CppUtils::ContainerOps::GetMemoryUsage{shortString}.Do();
+    if (shortUsage.HeapBytes != 0 || shortUsage.InlineBytes != sizeof(shortString) || CppUtils::ContainerOps::GetCapacity{shortString}.Do() < 3)
+    {
+        return false;
+    }
+
+    std::string longString(100, 'a');
+    const CppUtils::ContainerOps::ContainerMemoryUsage longUsage = CppUtils::ContainerOps::GetMemoryUsage{longString}.Do();
+    if (longUsage.HeapBytes != longString.capacity() + 1 || longUsage.SlackBytes != longString.capacity() - 100)
+    {
+        return false;
+    }
+
+    CppUtils::ContainerOps::GetElement{shortString}.Do(1) = 'x';
+    CppUtils::ContainerOps::EraseAtOrdered{shortString}.Do(0);
+    if (shortString != "xc" || CppUtils::ContainerOps::GetFront{shortString}.Do() != 'x' || CppUtils::ContainerOps::GetBack{shortString}.Do() != 'c')
+    {
+        return false;
+    }
+
+    // Views don't own their characters, and never give mutable access to them.
+    std::string_view stringView = longString;
+    static_assert(std::is_same_v<decltype(CppUtils::ContainerOps::GetElement{stringView}.Do(0)), const char&>);
+    if (CppUtils::ContainerOps::GetSize{stringView}.Do() != 100 || CppUtils::ContainerOps::GetMemoryUsage{stringView}.Do().HeapBytes != 0
+        || CppUtils::ContainerOps::GetData{stringView}.Do() != longString.data())
+    {
+        return false;
+    }
+
+    std::wstring wideString = L"wide";
+    const std::wstring_view emptyWideView;
+    if (CppUtils::ContainerOps::GetBack{wideString}.Do() != L'e' || !CppUtils::ContainerOps::IsEmpty{emptyWideView}.Do())
+    {
+        return false;
+    }
+
+    // Spans of const elements only give const access, even through mutable spans.
+    const std::vector<int> elements { 1, 2, 3 };
+    std::span<const int> constSpan = elements;
+    static_assert(std::is_same_v<decltype(CppUtils::ContainerOps::GetFront{constSpan}.Do()), const int&>);
+    return CppUtils::ContainerOps::GetBack{constSpan}.Do() == 3 && CppUtils::ContainerOps::GetData{constSpan}.Do() == elements.data();
+}
+
+template <class T>
+bool DoesRoundTripPackedInts(const std::vector<T>& values)
+{
+    const CppUtils::Containers::PackedIntArray<T> packed(values);
+
+    std::vector<T> decoded(values.size());
+    packed.Decode(decoded.data());
+    if (decoded != values || !std::equal(packed.begin(), packed.end(), values.begin(), values.end()))
+    {
+        return false;
+    }
+
+    // Out of order reads decode a block each.
+    for (std::size_t i = values.size(); i-- > 0;)
+    {
+        if (CppUtils::ContainerOps::GetElement{packed}.Do(i) != values[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DoesPassPackedIntArrayChecks()
+{
+    // Sorted ids (delta encoded), with a partial last block.
+    std::vector<std::uint64_t> postings;
+    for (std::uint64_t i = 0; i < 1000; ++i)
+    {
+        postings.push_back(1'000'000'000'000 + i * 7 + i % 3);
+    }
+    if (!DoesRoundTripPackedInts(postings))
+    {
+        return false;
+    }
+
+    // Delta encoding packs the postings into a few bits each.
+    const CppUtils::Containers::PackedIntArray<std::uint64_t> packedPostings(postings);
+    if (CppUtils::ContainerOps::GetMemoryUsage{packedPostings}.Do().HeapBytes * 8 > postings.size() * sizeof(std::uint64_t)
+        || CppUtils::ContainerOps::GetBack{packedPostings}.Do() != postings.back())
+    {
+        return false;
+    }
+
+    // Elements of different blocks are independent values.
+    if (!std::less<>{}(packedPostings[127], packedPostings[128])
+        || CppUtils::ContainerOps::GetElement{packedPostings}.Do(0) == CppUtils::ContainerOps::GetElement{packedPostings}.Do(128))
+    {
+        return false;
+    }
+
+    // Unsorted small-range values (frame of reference), negative ones included.
+    std::vector<std::int32_t> smallRange;
+    for (std::int32_t i = 0; i < 300; ++i)
+    {
+        smallRange.push_back((i * 37) % 101 - 50);
+    }
+
+    // Values too spread out to pack are stored as is. Constant values pack to nothing.
+    std::vector<std::int64_t> spread { INT64_MIN, INT64_MAX, 0, -1, 1 };
+    std::vector<std::uint8_t> constant(200, 42);
+
+    if (!DoesRoundTripPackedInts(smallRange) || !DoesRoundTripPackedInts(spread) || !DoesRoundTripPackedInts(constant)
+        || !DoesRoundTripPackedInts(std::vector<std::int16_t>{}))
+    {
+        return false;
+    }
+
+#if CPPUTILS_CONTAINERALGORITHMS_X86_SIMD
+    // The SIMD unpacking matches the scalar one at every bit width.
+    std::array<std::uint32_t, CppUtils::Containers::Detail::PackedIntBlockSize> offsets;
+    for (std::uint32_t bitWidth = 0; bitWidth <= 32; ++bitWidth)
+    {
+        for (std::size_t i = 0; i < offsets.size(); ++i)
+        {
+            offsets[i] = static_cast<std::uint32_t>(i * 2654435761u) & CppUtils::Containers::Detail::GetPackedIntMask(bitWidth);
+        }
+
+        std::vector<std::uint32_t> words(bitWidth * CppUtils::Containers::Detail::PackedIntLaneCount, 0);
+        CppUtils::Containers::Detail::PackIntBlock(offsets.data(), bitWidth, words.data());
+
+        std::array<std::uint32_t, CppUtils::Containers::Detail::PackedIntBlockSize> scalarOffsets;
+        std::array<std::uint32_t, CppUtils::Containers::Detail::PackedIntBlockSize> simdOffsets;
+        CppUtils::Containers::Detail::UnpackIntBlockScalar(words.data(), bitWidth, scalarOffsets.data());
+        CppUtils::Containers::Detail::UnpackIntBlockSse2(words.data(), bitWidth, simdOffsets.data());
+        if (scalarOffsets != offsets || simdOffsets != offsets)
+        {
+            return false;
+        }
+    }
+#endif
+
+    return true;
+}
+
+bool DoesPassStreamChecks()
+{
+    std::vector<std::uint32_t> values(1000);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<std::uint32_t>(i * 3);
+    }
+    const CppUtils::Containers::PackedIntArray<std::uint32_t> packedValues(values);
+    const std::uint64_t expectedSum = 3 * 999 * 1000 / 2;
+
+    // Contiguous containers are streamed in place.
+    std::uint64_t sum = 0;
+    std::size_t chunkCount = 0;
+    for (const std::span<const std::uint32_t> chunk : CppUtils::ContainerAlgorithms::StreamChunks(values, 64))
+    {
+        if (chunk.data() != values.data() + chunkCount * 64 || chunk.size() > 64)
+        {
+            return false;
+        }
+        sum = std::accumulate(chunk.begin(), chunk.end(), sum);
+        ++chunkCount;
+    }
+    if (sum != expectedSum || chunkCount != 16)
+    {
+        return false;
+    }
+
+    // Others are copied chunk by chunk, synchronously or by the executor.
+    sum = 0;
+    for (const std::span<const std::uint32_t> chunk : CppUtils::ContainerAlgorithms::StreamChunks(packedValues, 100))
+    {
+        sum = std::accumulate(chunk.begin(), chunk.end(), sum);
+    }
+    if (sum != expectedSum)
+    {
+        return false;
+    }
+
+    CppUtils::ContainerAlgorithms::StreamExecutor executor;
+    std::vector<std::uint32_t> streamed;
+    for (const std::span<const std::uint32_t> chunk : CppUtils::ContainerAlgorithms::StreamChunksAsync(packedValues, 96, executor))
+    {
+        streamed.insert(streamed.end(), chunk.begin(), chunk.end());
+    }
+    if (streamed != values)
+    {
+        return false;
+    }
+
+    // Abandoning a stream waits for the chunk being filled.
+    for (const std::span<const std::uint32_t> chunk : CppUtils::ContainerAlgorithms::StreamChunksAsync(packedValues, 10, executor))
+    {
+        if (chunk.front() == 0)
+        {
+            break;
+        }
+    }
+
+    // Zero threads and zero sized chunks are treated as one.
+    CppUtils::ContainerAlgorithms::StreamExecutor zeroThreadExecutor(0);
+    chunkCount = 0;
+    for (const std::span<const std::uint32_t> chunk : CppUtils::ContainerAlgorithms::StreamChunksAsync(packedValues, 0, zeroThreadExecutor))
+    {
+        if (chunk.size() != 1 || chunk.front() != values[chunkCount++])
+        {
+            return false;
+        }
+    }
+    if (chunkCount != values.size())
+    {
+        return false;
+    }
+
+    const std::vector<int> emptyVector;
+    const CppUtils::Containers::PackedIntArray<int> emptyPacked;
+    return CppUtils::ContainerAlgorithms::StreamChunks(emptyVector, 8).begin() == std::default_sentinel
+        && CppUtils::ContainerAlgorithms::StreamChunksAsync(emptyPacked, 8, executor).begin() == std::default_sentinel;
+}
+
+bool DoesPassSegmentedVectorChecks()
+{
+    // 16 elements per block.
+    CppUtils::Containers::SegmentedVector<int, 64> segmentedVector;
+    segmentedVector.PushBack(0);
+    const int* const firstElement = &segmentedVector[0];
+    for (int i = 1; i < 100; ++i)
+    {
+        segmentedVector.PushBack(i);
+    }
+
+    // Growing never moves elements.
+    if (&segmentedVector[0] != firstElement || segmentedVector.GetBlockCount() != 7 || CppUtils::ContainerOps::GetCapacity{segmentedVector}.Do() != 112)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        if (CppUtils::ContainerOps::GetElement{segmentedVector}.Do(i) != static_cast<int>(i))
+        {
+            return false;
+        }
+    }
+
+    // Ordered erasure shifts across block boundaries.
+    CppUtils::ContainerOps::EraseAtOrdered{segmentedVector}.Do(10);
+    CppUtils::ContainerOps::EraseAtUnordered{segmentedVector}.Do(0);
+    if (segmentedVector[0] != 99 || segmentedVector[10] != 11 || segmentedVector[15] != 16 || segmentedVector[16] != 17
+        || CppUtils::ContainerOps::GetBack{segmentedVector}.Do() != 98)
+    {
+        return false;
+    }
+
+    CppUtils::ContainerOps::Truncate{segmentedVector}.Do(20);
+    CppUtils::ContainerOps::ShrinkToFit{segmentedVector}.Do();
+    if (segmentedVector.GetBlockCount() != 2 || CppUtils::ContainerOps::GetMemoryUsage{segmentedVector}.Do().SlackBytes != 12 * sizeof(int))
+    {
+        return false;
+    }
+
+    const CppUtils::Containers::SegmentedVector<int, 64> copy = segmentedVector;
+    if (!std::equal(copy.begin(), copy.end(), segmentedVector.begin(), segmentedVector.end()))
+    {
+        return false;
+    }
+
+    // Huge page blocks are aligned to the huge page size, whether or not the system backs them with huge pages.
+    CppUtils::Containers::SegmentedVector<std::uint64_t> hugePageVector(true);
+    hugePageVector.PushBack(1);
+    return reinterpret_cast<std::uintptr_t>(&hugePageVector[0]) % CppUtils::Containers::HugePageSize == 0
+        && CppUtils::ContainerOps::GetMemoryUsage{hugePageVector}.Do().HeapBytes >= CppUtils::Containers::HugePageSize;
+}
+
+template <class HeapType, class CompareType>
+bool DoesMatchPriorityQueue(HeapType& heap, const CompareType compare)
+{
+    std::priority_queue<int, std::vector<int>, CompareType> priorityQueue(compare);
+    std::uint32_t random = 12345;
+    for (int i = 0; i < 2000; ++i)
+    {
+        random = random * 1664525 + 1013904223;
+        const int value = static_cast<int>(random >> 20);
+
+        heap.Push(value);
+        priorityQueue.push(value);
+
+        // Interleave pops, to sift down heaps of every shape.
+        if (i % 3 == 0)
+        {
+            if (heap.PopTop() != priorityQueue.top())
+            {
+                return false;
+            }
+            priorityQueue.pop();
+        }
+    }
+
+    while (!CppUtils::ContainerOps::IsEmpty{heap}.Do())
+    {
+        if (CppUtils::ContainerOps::GetFront{heap}.Do() != priorityQueue.top())
+        {
+            return false;
+        }
+        heap.Pop();
+        priorityQueue.pop();
+    }
+    return priorityQueue.empty();
+}
+
+/*
+* Element whose copies throw while armed, and whose moves may throw, so containers must copy it to survive a failed copy.
+*/
+struct ThrowingCopyElement
+{
+    static inline bool bThrowOnCopy = false;
+
+    int Value = 0;
+
+    explicit ThrowingCopyElement(const int value)
+        : Value(value)
+    {
+    }
+
+    ThrowingCopyElement(const ThrowingCopyElement& other)
+        : Value(other.Value)
+    {
+        if (bThrowOnCopy)
+        {
+            throw std::runtime_error("Copy failed.");
+        }
+    }
+
+    ThrowingCopyElement(ThrowingCopyElement&& other) noexcept(false)
+        : Value(std::exchange(other.Value, -1))
+    {
+    }
+
+    ThrowingCopyElement& operator=(const ThrowingCopyElement&) = default;
+
+    ThrowingCopyElement& operator=(ThrowingCopyElement&& other) noexcept(false)
+    {
+        Value = std::exchange(other.Value, -1);
+        return *this;
+    }
+
+    bool operator<(const ThrowingCopyElement& other) const { return Value < other.Value; }
+};
+
+bool DoesPassDaryHeapChecks()
+{
+    CppUtils::Containers::DaryHeap<int> quaternaryHeap;
+    CppUtils::Containers::DaryHeap<int, 8, std::greater<int>> octonaryMinHeap;
+    if (!DoesMatchPriorityQueue(quaternaryHeap, std::less<int>{}) || !DoesMatchPriorityQueue(octonaryMinHeap, std::greater<int>{}))
+    {
+        return false;
+    }
+
+    // Batch pushes build the heap at once, or sift up when small relative to the heap.
+    std::vector<int> values(100);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<int>((i * 37) % 100);
+    }
+    CppUtils::Containers::DaryHeap<int, 8> heap;
+    heap.PushMany(values.begin(), values.end());
+    heap.PushMany(values.begin(), values.begin() + 10);
+
+    // Top-k.
+    std::vector<int> topValues;
+    heap.PopMany(4, std::back_inserter(topValues));
+    if (topValues != std::vector<int>{ 99, 98, 97, 96 } || CppUtils::ContainerOps::GetSize{heap}.Do() != 106
+        || CppUtils::ContainerOps::GetCapacity{heap}.Do() < 110)
+    {
+        return false;
+    }
+
+    // Pushing the heap's own elements while full reads them before growing frees them.
+    CppUtils::Containers::DaryHeap<std::string> stringHeap;
+    for (int i = 0; i < 16; ++i)
+    {
+        stringHeap.Push(std::string(32, static_cast<char>('a' + i)));
+    }
+    stringHeap.Push(stringHeap.GetTop());
+    stringHeap.PushMany(stringHeap.begin(), stringHeap.end());
+    if (stringHeap.GetSize() != 34 || stringHeap.PopTop() != std::string(32, 'p') || stringHeap.PopTop() != std::string(32, 'p'))
+    {
+        return false;
+    }
+
+    const CppUtils::Containers::DaryHeap<std::string> stringHeapCopy = stringHeap;
+    if (!std::equal(stringHeapCopy.begin(), stringHeapCopy.end(), stringHeap.begin(), stringHeap.end()))
+    {
+        return false;
+    }
+
+    // Growing copies elements whose moves may throw, so a throwing copy leaves the heap as it was.
+    CppUtils::Containers::DaryHeap<ThrowingCopyElement> throwingHeap;
+    for (int i = 0; i < 16; ++i)
+    {
+        throwingHeap.Push(ThrowingCopyElement(i));
+    }
+    bool bThrew = false;
+    ThrowingCopyElement::bThrowOnCopy = true;
+    try
+    {
+        throwingHeap.Reserve(64);
+    }
+    catch (const std::runtime_error&)
+    {
+        bThrew = true;
+    }
+    ThrowingCopyElement::bThrowOnCopy = false;
+    if (!bThrew || throwingHeap.GetCapacity() != 16 || throwingHeap.GetTop().Value != 15
+        || std::any_of(throwingHeap.begin(), throwingHeap.end(), [](const ThrowingCopyElement& element) { return element.Value < 0; }))
+    {
+        return false;
+    }
+
+    // Every group of siblings starts on a multiple of the group size, so never straddles cache lines.
+    return reinterpret_cast<std::uintptr_t>(heap.begin() + 1) % (8 * sizeof(int)) == 0
+        && reinterpret_cast<std::uintptr_t>(heap.begin() + 9) % (8 * sizeof(int)) == 0;
+}
+
+#if defined(CPPUTILS_CONTAINEROPS_INSTRUMENT)
+bool DoesPassInstrumentationChecks()
+{
+    namespace Instrumentation = CppUtils::ContainerOps::Instrumentation;
+
+    Instrumentation::ResetThreadCounters();
+
+    std::vector<int> stdVector;
+    stdVector.reserve(1);
+    CppUtils::ContainerOps::GetCapacity{stdVector}.Do();
+    stdVector.resize(64); // Forces a reallocation.
+    CppUtils::ContainerOps::GetCapacity{stdVector}.Do();
+    CppUtils::ContainerOps::GetSize{stdVector}.Do();
+
+    bool bFoundCapacityCounter = false;
+    for (const Instrumentation::ContainerOpCounter& counter : Instrumentation::GetThreadCounters())
+    {
+        // Counters of other container types remain after the reset, with zero counts.
+        if (counter.OpName == "GetCapacity" && counter.CallCount > 0)
+        {
+            bFoundCapacityCounter = counter.CallCount == 2 && counter.CapacityChangeCount == 1;
+        }
+    }
+
+    if (!bFoundCapacityCounter)
+    {
+        return false;
+    }
+
+    // Resetting forgets observed capacities, so a change across the reset isn't counted.
+    Instrumentation::ResetThreadCounters();
+    stdVector.resize(1024);
+    CppUtils::ContainerOps::GetCapacity{stdVector}.Do();
+    for (const Instrumentation::ContainerOpCounter& counter : Instrumentation::GetThreadCounters())
+    {
+        if (counter.OpName == "GetCapacity" && counter.CapacityChangeCount > 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
 int main(int argc, char** argv)
 {
     // Test all operations on all supported container types.
@@ -68,6 +1234,20 @@ int main(int argc, char** argv)
     std::array<int, 3> stdArray { -1, -1, -1 };
     std::vector<int> stdVector  { -1, -1, -1 };
 
+    CppUtils::Containers::SlotMap<int> slotMap;
+    slotMap.Reserve(3);
+    for (int i = 0; i < 3; ++i)
+    {
+        slotMap.Insert(-1);
+    }
+
+    CppUtils::Containers::PaddedArray<int, 3> paddedArray;
+    CppUtils::Containers::PerThreadArray<int> perThreadArray(3);
+
+    std::array<int, 3> spannedArray { -1, -1, -1 };
+    std::span<int, 3> staticSpan = spannedArray;
+    std::span<int> dynamicSpan = spannedArray;
+
     if (!DoesPassOperationChecks(rawArr))
     {
         return -1;
@@ -83,5 +1263,132 @@ int main(int argc, char** argv)
         return -1;
     }
 
+    if (!DoesPassOperationChecks(slotMap))
+    {
+        return -1;
+    }
+
+    if (!DoesPassOperationChecks(paddedArray))
+    {
+        return -1;
+    }
+
+    if (!DoesPassOperationChecks(perThreadArray))
+    {
+        return -1;
+    }
+
+    if (!DoesPassOperationChecks(staticSpan))
+    {
+        return -1;
+    }
+
+    if (!DoesPassOperationChecks(dynamicSpan))
+    {
+        return -1;
+    }
+
+    if (!DoesPassMemoryUsageChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassCompactionChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassBulkCopyChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassCompareAndHashChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassSortChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassFindChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassEraseChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassSlotMapChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassSparseSetChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassSnapshotVectorChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassPerThreadArrayChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassContainerViewChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassConcatViewChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassTensorChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassStringChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassPackedIntArrayChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassStreamChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassSegmentedVectorChecks())
+    {
+        return -1;
+    }
+
+    if (!DoesPassDaryHeapChecks())
+    {
+        return -1;
+    }
+
+#if defined(CPPUTILS_CONTAINEROPS_INSTRUMENT)
+    if (!DoesPassInstrumentationChecks())
+    {
+        return -1;
+    }
+#endif
+
     return 0;
 }